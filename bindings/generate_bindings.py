@@ -33,6 +33,59 @@ def get_api_info(nvim):
     info = subprocess.check_output(args)
     return decutf8(msgpack.unpackb(info))
 
+def function_hash(seed, name):
+    """
+    32bit FNV-1a hash of name, the seed selects one of a family of hashes.
+    This must match functionHash() in neovimapi.cpp
+    """
+    h = (2166136261 ^ (seed * 2654435769)) & 0xffffffff
+    for c in name.encode('utf8'):
+        h = ((h ^ c) * 16777619) & 0xffffffff
+    return h
+
+def perfect_hash(names):
+    """
+    Build a minimal perfect hash (hash and displace) for a list of names.
+
+    Returns (seeds, slots). A name is found at slots[i] where i is
+    function_hash(d, name) % len(names), with d = seeds[function_hash(0, name) % len(names)],
+    or i = -d-1 if d is negative.
+    """
+    size = len(names)
+    buckets = [[] for _ in range(size)]
+    for name in names:
+        buckets[function_hash(0, name) % size].append(name)
+    buckets.sort(key=len, reverse=True)
+
+    seeds = [0] * size
+    slots = [None] * size
+    b = 0
+    # Buckets with collisions, search for a seed that places all of their names
+    for b, bucket in enumerate(buckets):
+        if len(bucket) <= 1:
+            break
+        d = 1
+        placed = []
+        while len(placed) < len(bucket):
+            slot = function_hash(d, bucket[len(placed)]) % size
+            if slots[slot] is not None or slot in placed:
+                d += 1
+                placed = []
+            else:
+                placed.append(slot)
+        seeds[function_hash(0, bucket[0]) % size] = d
+        for slot, name in zip(placed, bucket):
+            slots[slot] = name
+    # Single names go straight into the remaining slots
+    free = [i for i in range(size) if slots[i] is None]
+    for bucket in buckets[b:]:
+        if not bucket:
+            break
+        slot = free.pop()
+        seeds[function_hash(0, bucket[0]) % size] = -slot - 1
+        slots[slot] = bucket[0]
+    return seeds, slots
+
 def generate_file(name, outfile, **kw):
     from jinja2 import Environment, FileSystemLoader
     env=Environment(loader=FileSystemLoader('bindings'), trim_blocks=True)
@@ -119,6 +172,8 @@ class Function:
         self.fun = nvim_fun
         self.parameters = []
         self.name =  self.fun['name']
+        # API level that introduced this function
+        self.since = self.fun.get('since', 0)
         try:
             self.return_type = NeovimTypeVal(self.fun['return_type'])
             for param in self.fun['parameters']:
@@ -135,6 +190,12 @@ class Function:
 
         # Build the argument string - makes it easier for the templates
         self.argstring = ', '.join(['%s %s' % (tv.native_type, tv.name) for tv in self.parameters])
+        # Return and parameter types, @see Function::typeSignature()
+        self.type_signature = '%s(%s)' % (self.return_type.neovim_type,
+                ', '.join([tv.neovim_type for tv in self.parameters]))
+        # Same arguments followed by a callback that receives the decoded result
+        self.argstring_callback = ', '.join(['%s %s' % (tv.native_type, tv.name) for tv in self.parameters]
+                + ['std::function<void(%s)> callback' % self.return_type.native_type])
         self.valid = True
 
     def is_method(self):
@@ -234,12 +295,12 @@ if __name__ == '__main__':
             env['date'] = datetime.datetime.now()
             functions = [Function(f) for f in api['functions'] if f['name'] != 'vim_get_api_info']
             env['functions'] = [f for f in functions if f.valid]
+            env['function_seeds'], env['function_slots'] = perfect_hash([f.name for f in env['functions']])
             exttypes = { typename:info['id'] for typename,info in api['types'].items()}
             env['exttypes'] = exttypes
             env['api_level'] = api_level
-            fname, fext = os.path.splitext(name)
-            fname = '{}{}{}'.format(fname, api_level, fext)
-            outfile = os.path.join(outpath, fname)
+            # A single binding covers all API levels up to api_level
+            outfile = os.path.join(outpath, name)
             generate_file(name, outfile, **env)
 
     else:
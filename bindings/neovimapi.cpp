@@ -1,15 +1,17 @@
 // Auto generated {{date}} from nvim API level:{{api_level}}
-#include "auto/neovimapi{{api_level}}.h"
+#include "auto/neovimapi.h"
 #include "neovimconnector.h"
 #include "msgpackrequest.h"
 #include "msgpackiodevice.h"
 #include "util.h"
 
+#include <vector>
+
 namespace NeovimQt {
 /* Unpack Neovim EXT types Window, Buffer Tabpage which are all
  * uint64_t see Neovim:msgpack_rpc_to_
  */
-QVariant unpackBufferApi{{api_level}}(MsgpackIODevice *dev, const char* in, quint32 size)
+static QVariant unpackBufferApi(MsgpackIODevice *dev, const char* in, quint32 size)
 {
 	msgpack_unpacked result;
 	msgpack_unpacked_init(&result);
@@ -34,38 +36,63 @@ QVariant unpackBufferApi{{api_level}}(MsgpackIODevice *dev, const char* in, quin
 	msgpack_unpacked_destroy(&result);
 	return variant;
 }
-#define unpackWindowApi{{api_level}} unpackBufferApi{{api_level}}
-#define unpackTabpageApi{{api_level}} unpackBufferApi{{api_level}}
+#define unpackWindowApi unpackBufferApi
+#define unpackTabpageApi unpackBufferApi
 
-NeovimApi{{api_level}}::NeovimApi{{api_level}}(NeovimConnector *c)
+NeovimApi::NeovimApi(NeovimConnector *c)
 :m_c(c)
 {
 	// EXT types
 	{% for typename in exttypes %}
-	m_c->m_dev->registerExtType({{exttypes[typename]}}, unpack{{typename}}Api{{api_level}});
+	m_c->m_dev->registerExtType({{exttypes[typename]}}, unpack{{typename}}Api);
 	{% endfor %}
 	connect(m_c->m_dev, &MsgpackIODevice::notification,
-			this, &NeovimApi{{api_level}}::neovimNotification);
+			this, &NeovimApi::neovimNotification);
 }
 
 // Slots
 {% for f in functions %}
-MsgpackRequest* NeovimApi{{api_level}}::{{f.name}}({{f.argstring}})
+MsgpackRequest* NeovimApi::{{f.name}}({{f.argstring}})
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("{{f.name}}", {{f.argcount}});
+	r->setFunction(NeovimApi::NEOVIM_FN_{{f.name.upper()}});
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+{% for param in f.parameters %}
+	m_c->m_dev->{{param.sendmethod}}({{param.name}});
+{% endfor %}
+	return r;
+}
+{% endfor %}
+
+// Typed callbacks
+{% for f in functions %}
+{% if f.return_type.native_type != 'void' %}
+MsgpackRequest* NeovimApi::{{f.name}}({{f.argstring_callback}})
 {
 	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("{{f.name}}", {{f.argcount}});
-	r->setFunction(NeovimApi{{api_level}}::NEOVIM_FN_{{f.name.upper()}});
-	connect(r, &MsgpackRequest::finished, this, &NeovimApi{{api_level}}::handleResponse);
-	connect(r, &MsgpackRequest::error, this, &NeovimApi{{api_level}}::handleResponseError);
+	r->setFunction(NeovimApi::NEOVIM_FN_{{f.name.upper()}});
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		{{f.return_type.native_type}} data;
+		if (dev->{{f.return_type.decodemethod}}(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for {{f.name}}");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
 {% for param in f.parameters %}
 	m_c->m_dev->{{param.sendmethod}}({{param.name}});
 {% endfor %}
 	return r;
 }
+{% endif %}
 {% endfor %}
 
 // Handlers
 
-void NeovimApi{{api_level}}::handleResponseError(quint32 msgid, quint64 fun, const QVariant& res)
+void NeovimApi::handleResponseError(quint32 msgid, quint64 fun, const QVariant& res)
 {
 
 	// TODO: support Neovim error types Exception/Validation/etc
@@ -81,7 +108,7 @@ void NeovimApi{{api_level}}::handleResponseError(quint32 msgid, quint64 fun, con
 
 	switch(fun) {
 {% for f in functions %}
-	case NeovimApi{{api_level}}::NEOVIM_FN_{{f.name.upper()}}:
+	case NeovimApi::NEOVIM_FN_{{f.name.upper()}}:
 		emit err_{{f.name}}(errMsg, res);
 		break;
 {% endfor %}
@@ -90,11 +117,11 @@ void NeovimApi{{api_level}}::handleResponseError(quint32 msgid, quint64 fun, con
 	}
 }
 
-void NeovimApi{{api_level}}::handleResponse(quint32 msgid, quint64 fun, const QVariant& res)
+void NeovimApi::handleResponse(quint32 msgid, quint64 fun, const QVariant& res)
 {
 	switch(fun) {
 {% for f in functions %}
-	case NeovimApi{{api_level}}::NEOVIM_FN_{{f.name.upper()}}:
+	case NeovimApi::NEOVIM_FN_{{f.name.upper()}}:
 		{
 {% if f.return_type.native_type != 'void' %}
 			{{f.return_type.native_type}} data;
@@ -116,48 +143,135 @@ void NeovimApi{{api_level}}::handleResponse(quint32 msgid, quint64 fun, const QV
 	}
 }
 
+/**
+ * 32bit FNV-1a hash, the seed selects one of a family of hashes. This
+ * must match function_hash() in generate_bindings.py
+ */
+static constexpr quint32 functionHash(quint32 h, const char *name, size_t size)
+{
+	return size == 0 ? h : functionHash((h ^ static_cast<quint8>(*name)) * 16777619u, name + 1, size - 1);
+}
+
+static constexpr quint32 functionHashSeed(qint32 seed)
+{
+	return 2166136261u ^ (static_cast<quint32>(seed) * 2654435769u);
+}
+
+struct FunctionTableEntry
+{
+	const char *name;
+	NeovimApi::FunctionId id;
+	/// Return and parameter types, @see Function::typeSignature
+	const char *signature;
+};
+
+/// Number of functions in the bindings
+static constexpr size_t c_functionCount{ {{functions|length}} };
+
+/// Perfect hash seeds, indexed by the seed 0 hash of the function name
+static constexpr qint32 c_functionSeeds[c_functionCount] {
+{% for seed in function_seeds %}
+	{{seed}},
+{% endfor %}
+};
+
+/// Perfect hash table of all functions, @see perfect_hash in generate_bindings.py
+static constexpr FunctionTableEntry c_functionTable[c_functionCount] {
+{% for name in function_slots %}
+{% set f = functions|selectattr('name', 'equalto', name)|first %}
+	{ "{{f.name}}", NeovimApi::NEOVIM_FN_{{f.name.upper()}}, "{{f.type_signature}}" },
+{% endfor %}
+};
+
+static const FunctionTableEntry* findFunction(const QByteArray& name)
+{
+	const qint32 seed{ c_functionSeeds[functionHash(functionHashSeed(0), name.constData(), name.size()) % c_functionCount] };
+	const size_t slot{ seed < 0
+		? static_cast<size_t>(-seed - 1)
+		: functionHash(functionHashSeed(seed), name.constData(), name.size()) % c_functionCount };
+
+	const FunctionTableEntry& entry{ c_functionTable[slot] };
+	return name == entry.name ? &entry : nullptr;
+}
+
+/**
+ * Find a function by name, returns NEOVIM_FN_NULL for unknown functions
+ */
+NeovimApi::FunctionId NeovimApi::functionId(const QByteArray& name)
+{
+	const FunctionTableEntry *entry{ findFunction(name) };
+	return entry ? entry->id : NEOVIM_FN_NULL;
+}
+
+/**
+ * Find a function with the same name, return and parameter types as f,
+ * returns NEOVIM_FN_NULL if the bindings have no such function
+ */
+NeovimApi::FunctionId NeovimApi::functionId(const Function& f)
+{
+	const FunctionTableEntry *entry{ findFunction(f.name.toUtf8()) };
+	if (!entry || f.typeSignature() != QLatin1String(entry->signature)) {
+		return NEOVIM_FN_NULL;
+	}
+	return entry->id;
+}
+
+/**
+ * The API level in which a function was introduced
+ */
+quint64 NeovimApi::functionApiLevel(FunctionId f)
+{
+	switch(f) {
+{% for since, group in functions|groupby('since') %}
+{% for f in group %}
+	case NeovimApi::NEOVIM_FN_{{f.name.upper()}}:
+{% endfor %}
+		return {{since}};
+{% endfor %}
+	default:
+		return 0;
+	}
+}
+
+/**
+ * True if the function is available at the API level negotiated with Neovim
+ */
+bool NeovimApi::hasFunction(FunctionId f) const
+{
+	return f != NEOVIM_FN_NULL && functionApiLevel(f) <= m_c->apiLevel();
+}
+
 /**
  * Check function table from api_metadata[1]
  *
- * This checks the API metadata build from the bindings against the metadata
- * passed as argument.
+ * This checks the API metadata build from the bindings, for functions up to
+ * the given API level, against the metadata passed as argument.
  *
  * Returns false if there is an API mismatch
  */
-bool NeovimApi{{api_level}}::checkFunctions(const QVariantList& ftable)
+bool NeovimApi::checkFunctions(const QVariantList& ftable, quint64 apiLevel)
 {
-
-	QList<Function> required;
-	required
-	{% for f in functions %}
-	<< Function("{{f.return_type.neovim_type}}", "{{f.name}}",
-			QList<QString>()
-			{% for param in f.parameters %}
-			<< QString("{{param.neovim_type}}")
-			{% endfor %}
-			, false)
-	{% endfor %}
-	;
-
-
-	QList<Function> supported;
+	// Indexed by FunctionId
+	std::vector<bool> supported(c_functionCount + 1, false);
 	foreach(const QVariant& val, ftable) {
 		auto f = Function::fromVariant(val);
 		if (!f.isValid()) {
 			qDebug() << "Invalid function in metadata" << f;
 			continue;
 		}
-		supported.append(f);
 
-		if (!required.contains(f)) {
-			qDebug() << "Unknown function(api {{api_level}})" << f;
+		const FunctionId id{ functionId(f) };
+		if (id == NEOVIM_FN_NULL) {
+			qDebug() << "Unknown function(api" << apiLevel << ")" << f;
+			continue;
 		}
+		supported[id] = true;
 	}
 
 	bool ok = true;
-	foreach(const Function& f, required) {
-		if (!supported.contains(f)) {
-			qDebug() << "- instance DOES NOT support API{{api_level}}:" << f;
+	for (const FunctionTableEntry& entry : c_functionTable) {
+		if (functionApiLevel(entry.id) <= apiLevel && !supported[entry.id]) {
+			qDebug() << "- instance DOES NOT support API" << apiLevel << ":" << entry.name << entry.signature;
 			ok = false;
 		}
 	}
@@ -1,6 +1,7 @@
 // Auto generated {{date}} from nvim API level:{{api_level}}
 #pragma once
 
+#include <functional>
 #include <QObject>
 #include <QPoint>
 #include <QVariant>
@@ -13,7 +14,13 @@ namespace NeovimQt {
 class NeovimConnector;
 class MsgpackRequest;
 
-class NeovimApi{{api_level}}: public QObject
+/**
+ * Bindings for all Neovim API functions up to API level {{api_level}}
+ *
+ * A single instance serves every API level, NeovimConnector hands it out
+ * for the levels supported by the Neovim instance.
+ */
+class NeovimApi: public QObject
 {
 	Q_OBJECT
 
@@ -27,10 +34,13 @@ public:
 	};
 	Q_ENUM(FunctionId)
 
-	static bool checkFunctions(const QVariantList& ftable);
+	static bool checkFunctions(const QVariantList& ftable, quint64 apiLevel);
 	static FunctionId functionId(const Function& f);
+	static FunctionId functionId(const QByteArray& name);
+	static quint64 functionApiLevel(FunctionId f);
 
-	NeovimApi{{api_level}}(NeovimConnector *);
+	NeovimApi(NeovimConnector *);
+	bool hasFunction(FunctionId f) const;
 protected slots:
 	void handleResponse(quint32 id, quint64 fun, const QVariant&);
 	void handleResponseError(quint32 id, quint64 fun, const QVariant&);
@@ -48,6 +58,14 @@ public slots:
 	NeovimQt::MsgpackRequest* {{f.name}}({{f.argstring}});
 {% endfor %}
 
+public:
+	// Typed callbacks, the result is decoded directly from msgpack
+{% for f in functions %}
+{% if f.return_type.native_type != 'void' %}
+	NeovimQt::MsgpackRequest* {{f.name}}({{f.argstring_callback}});
+{% endif %}
+{% endfor %}
+
 signals:
 {% for f in functions %}
 	void on_{{f.name}}({{f.return_type.native_type}});
@@ -56,4 +74,8 @@ signals:
 {% endfor %}
 };
 
+{% for level in range(api_level + 1) %}
+typedef NeovimApi NeovimApi{{level}};
+{% endfor %}
+
 } // namespace NeovimQt
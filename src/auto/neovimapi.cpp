@@ -0,0 +1,7569 @@
+// Auto generated 2026-10-18 01:42:26.849460 from nvim API level:6
+#include "auto/neovimapi.h"
+#include "neovimconnector.h"
+#include "msgpackrequest.h"
+#include "msgpackiodevice.h"
+#include "util.h"
+
+#include <vector>
+
+namespace NeovimQt {
+/* Unpack Neovim EXT types Window, Buffer Tabpage which are all
+ * uint64_t see Neovim:msgpack_rpc_to_
+ */
+static QVariant unpackBufferApi(MsgpackIODevice *dev, const char* in, quint32 size)
+{
+	msgpack_unpacked result;
+	msgpack_unpacked_init(&result);
+	msgpack_unpack_return ret = msgpack_unpack_next(&result, in, size, NULL);
+
+	QVariant variant;
+
+	if (ret == MSGPACK_UNPACK_SUCCESS) {
+		switch (result.data.type) {
+			case MSGPACK_OBJECT_NEGATIVE_INTEGER:
+				variant = (qint64)result.data.via.i64;
+				break;
+			case MSGPACK_OBJECT_POSITIVE_INTEGER:
+				variant = (quint64)result.data.via.u64;
+				break;
+			default:
+				// TODO it would be nice if we could call back MsgpackIoDevice method or primitive types here
+				qWarning() << "Unsupported type found for EXT type" << result.data.type << result.data;
+		}
+	}
+
+	msgpack_unpacked_destroy(&result);
+	return variant;
+}
+#define unpackWindowApi unpackBufferApi
+#define unpackTabpageApi unpackBufferApi
+
+NeovimApi::NeovimApi(NeovimConnector *c)
+:m_c(c)
+{
+	// EXT types
+		m_c->m_dev->registerExtType(0, unpackBufferApi);
+		m_c->m_dev->registerExtType(1, unpackWindowApi);
+		m_c->m_dev->registerExtType(2, unpackTabpageApi);
+		connect(m_c->m_dev, &MsgpackIODevice::notification,
+			this, &NeovimApi::neovimNotification);
+}
+
+// Slots
+MsgpackRequest* NeovimApi::nvim_buf_line_count(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_line_count", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_LINE_COUNT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_line(int64_t buffer, int64_t index)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_line", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_LINE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(index);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_attach(int64_t buffer, bool send_buffer, QVariantMap opts)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_attach", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_ATTACH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(send_buffer);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_detach(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_detach", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_DETACH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_set_line(int64_t buffer, int64_t index, QByteArray line)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_set_line", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_SET_LINE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(index);
+	m_c->m_dev->send(line);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_del_line(int64_t buffer, int64_t index)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_del_line", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_DEL_LINE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(index);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_line_slice(int64_t buffer, int64_t start, int64_t end, bool include_start, bool include_end)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_line_slice", 5);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_LINE_SLICE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(start);
+	m_c->m_dev->send(end);
+	m_c->m_dev->send(include_start);
+	m_c->m_dev->send(include_end);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_lines(int64_t buffer, int64_t start, int64_t end, bool strict_indexing)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_lines", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_LINES);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(start);
+	m_c->m_dev->send(end);
+	m_c->m_dev->send(strict_indexing);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_set_line_slice(int64_t buffer, int64_t start, int64_t end, bool include_start, bool include_end, QList<QByteArray> replacement)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_set_line_slice", 6);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_SET_LINE_SLICE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(start);
+	m_c->m_dev->send(end);
+	m_c->m_dev->send(include_start);
+	m_c->m_dev->send(include_end);
+	m_c->m_dev->sendArrayOf(replacement);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_set_lines(int64_t buffer, int64_t start, int64_t end, bool strict_indexing, QList<QByteArray> replacement)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_set_lines", 5);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_SET_LINES);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(start);
+	m_c->m_dev->send(end);
+	m_c->m_dev->send(strict_indexing);
+	m_c->m_dev->sendArrayOf(replacement);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_offset(int64_t buffer, int64_t index)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_offset", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OFFSET);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(index);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_var(int64_t buffer, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_changedtick(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_changedtick", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_CHANGEDTICK);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_keymap(int64_t buffer, QByteArray mode)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_keymap", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_KEYMAP);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(mode);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_set_keymap(int64_t buffer, QByteArray mode, QByteArray lhs, QByteArray rhs, QVariantMap opts)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_set_keymap", 5);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_SET_KEYMAP);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(mode);
+	m_c->m_dev->send(lhs);
+	m_c->m_dev->send(rhs);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_del_keymap(int64_t buffer, QByteArray mode, QByteArray lhs)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_del_keymap", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_DEL_KEYMAP);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(mode);
+	m_c->m_dev->send(lhs);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_commands(int64_t buffer, QVariantMap opts)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_commands", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_COMMANDS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_set_var(int64_t buffer, QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_set_var", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_SET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_del_var(int64_t buffer, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_del_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_DEL_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_set_var(int64_t buffer, QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_set_var", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_SET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_del_var(int64_t buffer, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_del_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_DEL_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_option(int64_t buffer, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_option", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_set_option(int64_t buffer, QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_set_option", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_SET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_number(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_number", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NUMBER);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_name(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_name", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NAME);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_set_name(int64_t buffer, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_set_name", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_SET_NAME);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_is_loaded(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_is_loaded", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_IS_LOADED);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_is_valid(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_IS_VALID);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_insert(int64_t buffer, int64_t lnum, QList<QByteArray> lines)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_insert", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_INSERT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(lnum);
+	m_c->m_dev->sendArrayOf(lines);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_mark(int64_t buffer, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_mark", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_MARK);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_add_highlight(int64_t buffer, int64_t ns_id, QByteArray hl_group, int64_t line, int64_t col_start, int64_t col_end)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_add_highlight", 6);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_ADD_HIGHLIGHT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(ns_id);
+	m_c->m_dev->send(hl_group);
+	m_c->m_dev->send(line);
+	m_c->m_dev->send(col_start);
+	m_c->m_dev->send(col_end);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_clear_namespace(int64_t buffer, int64_t ns_id, int64_t line_start, int64_t line_end)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_clear_namespace", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_CLEAR_NAMESPACE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(ns_id);
+	m_c->m_dev->send(line_start);
+	m_c->m_dev->send(line_end);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_clear_highlight(int64_t buffer, int64_t ns_id, int64_t line_start, int64_t line_end)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_clear_highlight", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_CLEAR_HIGHLIGHT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(ns_id);
+	m_c->m_dev->send(line_start);
+	m_c->m_dev->send(line_end);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_set_virtual_text(int64_t buffer, int64_t ns_id, int64_t line, QVariantList chunks, QVariantMap opts)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_set_virtual_text", 5);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_SET_VIRTUAL_TEXT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(ns_id);
+	m_c->m_dev->send(line);
+	m_c->m_dev->send(chunks);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_list_wins(int64_t tabpage)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_list_wins", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_LIST_WINS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_get_var(int64_t tabpage, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_set_var(int64_t tabpage, QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_set_var", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_SET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_del_var(int64_t tabpage, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_del_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_DEL_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_set_var(int64_t tabpage, QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_set_var", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_SET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_del_var(int64_t tabpage, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_del_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_DEL_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_get_win(int64_t tabpage)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_get_win", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_WIN);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_get_number(int64_t tabpage)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_get_number", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_NUMBER);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_is_valid(int64_t tabpage)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_IS_VALID);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_ui_attach(int64_t width, int64_t height, QVariantMap options)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_ui_attach", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_UI_ATTACH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(width);
+	m_c->m_dev->send(height);
+	m_c->m_dev->send(options);
+	return r;
+}
+MsgpackRequest* NeovimApi::ui_attach(int64_t width, int64_t height, bool enable_rgb)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("ui_attach", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_UI_ATTACH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(width);
+	m_c->m_dev->send(height);
+	m_c->m_dev->send(enable_rgb);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_ui_detach()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_ui_detach", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_UI_DETACH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_ui_try_resize(int64_t width, int64_t height)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_ui_try_resize", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_UI_TRY_RESIZE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(width);
+	m_c->m_dev->send(height);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_ui_set_option(QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_ui_set_option", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_UI_SET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_ui_try_resize_grid(int64_t grid, int64_t width, int64_t height)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_ui_try_resize_grid", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_UI_TRY_RESIZE_GRID);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(grid);
+	m_c->m_dev->send(width);
+	m_c->m_dev->send(height);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_ui_pum_set_height(int64_t height)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_ui_pum_set_height", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_UI_PUM_SET_HEIGHT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(height);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_command(QByteArray command)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_command", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_COMMAND);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(command);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_hl_by_name(QByteArray name, bool rgb)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_hl_by_name", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_NAME);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(rgb);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_hl_by_id(int64_t hl_id, bool rgb)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_hl_by_id", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_ID);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(hl_id);
+	m_c->m_dev->send(rgb);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_feedkeys(QByteArray keys, QByteArray mode, bool escape_csi)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_feedkeys", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_FEEDKEYS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(keys);
+	m_c->m_dev->send(mode);
+	m_c->m_dev->send(escape_csi);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_input(QByteArray keys)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_input", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_INPUT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(keys);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_input_mouse(QByteArray button, QByteArray action, QByteArray modifier, int64_t grid, int64_t row, int64_t col)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_input_mouse", 6);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_INPUT_MOUSE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(button);
+	m_c->m_dev->send(action);
+	m_c->m_dev->send(modifier);
+	m_c->m_dev->send(grid);
+	m_c->m_dev->send(row);
+	m_c->m_dev->send(col);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_replace_termcodes(QByteArray str, bool from_part, bool do_lt, bool special)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_replace_termcodes", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_REPLACE_TERMCODES);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(str);
+	m_c->m_dev->send(from_part);
+	m_c->m_dev->send(do_lt);
+	m_c->m_dev->send(special);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_command_output(QByteArray command)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_command_output", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_COMMAND_OUTPUT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(command);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_eval(QByteArray expr)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_eval", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_EVAL);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(expr);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_execute_lua(QByteArray code, QVariantList args)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_execute_lua", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_EXECUTE_LUA);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(code);
+	m_c->m_dev->send(args);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_call_function(QByteArray fn, QVariantList args)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_call_function", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_CALL_FUNCTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(fn);
+	m_c->m_dev->send(args);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_call_dict_function(QVariant dict, QByteArray fn, QVariantList args)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_call_dict_function", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_CALL_DICT_FUNCTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(dict);
+	m_c->m_dev->send(fn);
+	m_c->m_dev->send(args);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_strwidth(QByteArray text)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_strwidth", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_STRWIDTH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(text);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_runtime_paths()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_runtime_paths", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_RUNTIME_PATHS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_set_current_dir(QByteArray dir)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_set_current_dir", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_DIR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(dir);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_current_line()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_current_line", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_LINE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_set_current_line(QByteArray line)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_set_current_line", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_LINE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(line);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_del_current_line()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_del_current_line", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_DEL_CURRENT_LINE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_var(QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_var", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_set_var(QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_set_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_del_var(QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_del_var", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_DEL_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_set_var(QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_set_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_SET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_del_var(QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_del_var", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_DEL_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_vvar(QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_vvar", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_VVAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_set_vvar(QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_set_vvar", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SET_VVAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_option(QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_option", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_set_option(QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_set_option", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_out_write(QByteArray str)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_out_write", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_OUT_WRITE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(str);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_err_write(QByteArray str)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_err_write", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_ERR_WRITE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(str);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_err_writeln(QByteArray str)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_err_writeln", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_ERR_WRITELN);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(str);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_bufs()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_bufs", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_BUFS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_current_buf()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_current_buf", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_BUF);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_set_current_buf(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_set_current_buf", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_BUF);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_wins()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_wins", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_WINS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_current_win()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_current_win", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_WIN);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_set_current_win(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_set_current_win", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_WIN);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_create_buf(bool listed, bool scratch)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_create_buf", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_CREATE_BUF);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(listed);
+	m_c->m_dev->send(scratch);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_open_win(int64_t buffer, bool enter, QVariantMap config)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_open_win", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_OPEN_WIN);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(enter);
+	m_c->m_dev->send(config);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_tabpages()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_tabpages", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_TABPAGES);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_current_tabpage()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_current_tabpage", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_TABPAGE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_set_current_tabpage(int64_t tabpage)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_set_current_tabpage", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_TABPAGE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_create_namespace(QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_create_namespace", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_CREATE_NAMESPACE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_namespaces()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_namespaces", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_NAMESPACES);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_paste(QByteArray data, bool crlf, int64_t phase)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_paste", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_PASTE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(data);
+	m_c->m_dev->send(crlf);
+	m_c->m_dev->send(phase);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_put(QList<QByteArray> lines, QByteArray type, bool after, bool follow)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_put", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_PUT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->sendArrayOf(lines);
+	m_c->m_dev->send(type);
+	m_c->m_dev->send(after);
+	m_c->m_dev->send(follow);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_subscribe(QByteArray event)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_subscribe", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SUBSCRIBE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(event);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_unsubscribe(QByteArray event)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_unsubscribe", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_UNSUBSCRIBE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(event);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_color_by_name(QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_color_by_name", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_BY_NAME);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_color_map()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_color_map", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_MAP);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_context(QVariantMap opts)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_context", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CONTEXT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_load_context(QVariantMap dict)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_load_context", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LOAD_CONTEXT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(dict);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_mode()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_mode", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_MODE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_keymap(QByteArray mode)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_keymap", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_KEYMAP);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(mode);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_set_keymap(QByteArray mode, QByteArray lhs, QByteArray rhs, QVariantMap opts)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_set_keymap", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SET_KEYMAP);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(mode);
+	m_c->m_dev->send(lhs);
+	m_c->m_dev->send(rhs);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_del_keymap(QByteArray mode, QByteArray lhs)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_del_keymap", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_DEL_KEYMAP);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(mode);
+	m_c->m_dev->send(lhs);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_commands(QVariantMap opts)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_commands", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_COMMANDS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_api_info()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_api_info", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_API_INFO);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_set_client_info(QByteArray name, QVariantMap version, QByteArray type, QVariantMap methods, QVariantMap attributes)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_set_client_info", 5);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SET_CLIENT_INFO);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(version);
+	m_c->m_dev->send(type);
+	m_c->m_dev->send(methods);
+	m_c->m_dev->send(attributes);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_chan_info(int64_t chan)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_chan_info", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CHAN_INFO);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(chan);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_chans()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_chans", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_CHANS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_call_atomic(QVariantList calls)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_call_atomic", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_CALL_ATOMIC);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(calls);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_parse_expression(QByteArray expr, QByteArray flags, bool highlight)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_parse_expression", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_PARSE_EXPRESSION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(expr);
+	m_c->m_dev->send(flags);
+	m_c->m_dev->send(highlight);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_uis()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_uis", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_UIS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_proc_children(int64_t pid)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_proc_children", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_PROC_CHILDREN);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(pid);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_proc(int64_t pid)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_proc", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_PROC);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(pid);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_select_popupmenu_item(int64_t item, bool insert, bool finish, QVariantMap opts)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_select_popupmenu_item", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_SELECT_POPUPMENU_ITEM);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(item);
+	m_c->m_dev->send(insert);
+	m_c->m_dev->send(finish);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_buf(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_buf", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_BUF);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_set_buf(int64_t window, int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_set_buf", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_SET_BUF);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_cursor(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_cursor", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CURSOR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_set_cursor(int64_t window, QPoint pos)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_set_cursor", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_SET_CURSOR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(pos);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_height(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_height", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_HEIGHT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_set_height(int64_t window, int64_t height)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_set_height", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_SET_HEIGHT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(height);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_width(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_width", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_WIDTH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_set_width(int64_t window, int64_t width)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_set_width", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_SET_WIDTH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(width);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_var(int64_t window, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_set_var(int64_t window, QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_set_var", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_SET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_del_var(int64_t window, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_del_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_DEL_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_set_var(int64_t window, QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_set_var", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_SET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_del_var(int64_t window, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_del_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_DEL_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_option(int64_t window, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_option", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_set_option(int64_t window, QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_set_option", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_SET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_position(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_position", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_POSITION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_tabpage(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_tabpage", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_TABPAGE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_number(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_number", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_NUMBER);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_is_valid(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_IS_VALID);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_set_config(int64_t window, QVariantMap config)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_set_config", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_SET_CONFIG);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(config);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_config(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_config", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CONFIG);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_close(int64_t window, bool force)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_close", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_CLOSE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(force);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_line_count(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_line_count", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_LINE_COUNT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_lines(int64_t buffer, int64_t start, int64_t end, bool strict_indexing)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_lines", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_LINES);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(start);
+	m_c->m_dev->send(end);
+	m_c->m_dev->send(strict_indexing);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_set_lines(int64_t buffer, int64_t start, int64_t end, bool strict_indexing, QList<QByteArray> replacement)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_set_lines", 5);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_SET_LINES);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(start);
+	m_c->m_dev->send(end);
+	m_c->m_dev->send(strict_indexing);
+	m_c->m_dev->sendArrayOf(replacement);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_var(int64_t buffer, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_option(int64_t buffer, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_option", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_set_option(int64_t buffer, QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_set_option", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_SET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_number(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_number", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_NUMBER);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_name(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_name", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_NAME);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_set_name(int64_t buffer, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_set_name", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_SET_NAME);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_is_valid(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_IS_VALID);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_mark(int64_t buffer, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_mark", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_MARK);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_add_highlight(int64_t buffer, int64_t ns_id, QByteArray hl_group, int64_t line, int64_t col_start, int64_t col_end)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_add_highlight", 6);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_ADD_HIGHLIGHT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(ns_id);
+	m_c->m_dev->send(hl_group);
+	m_c->m_dev->send(line);
+	m_c->m_dev->send(col_start);
+	m_c->m_dev->send(col_end);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_clear_highlight(int64_t buffer, int64_t ns_id, int64_t line_start, int64_t line_end)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_clear_highlight", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_CLEAR_HIGHLIGHT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(ns_id);
+	m_c->m_dev->send(line_start);
+	m_c->m_dev->send(line_end);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_get_windows(int64_t tabpage)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_get_windows", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOWS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_get_var(int64_t tabpage, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_GET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_get_window(int64_t tabpage)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_get_window", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOW);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_is_valid(int64_t tabpage)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_IS_VALID);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::ui_detach()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("ui_detach", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_UI_DETACH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::ui_try_resize(int64_t width, int64_t height)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("ui_try_resize", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_UI_TRY_RESIZE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(width);
+	m_c->m_dev->send(height);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_command(QByteArray command)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_command", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_COMMAND);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(command);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_feedkeys(QByteArray keys, QByteArray mode, bool escape_csi)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_feedkeys", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_FEEDKEYS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(keys);
+	m_c->m_dev->send(mode);
+	m_c->m_dev->send(escape_csi);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_input(QByteArray keys)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_input", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_INPUT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(keys);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_replace_termcodes(QByteArray str, bool from_part, bool do_lt, bool special)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_replace_termcodes", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_REPLACE_TERMCODES);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(str);
+	m_c->m_dev->send(from_part);
+	m_c->m_dev->send(do_lt);
+	m_c->m_dev->send(special);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_command_output(QByteArray command)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_command_output", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_COMMAND_OUTPUT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(command);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_eval(QByteArray expr)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_eval", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_EVAL);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(expr);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_call_function(QByteArray fn, QVariantList args)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_call_function", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_CALL_FUNCTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(fn);
+	m_c->m_dev->send(args);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_strwidth(QByteArray text)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_strwidth", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_STRWIDTH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(text);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_list_runtime_paths()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_list_runtime_paths", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_LIST_RUNTIME_PATHS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_change_directory(QByteArray dir)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_change_directory", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_CHANGE_DIRECTORY);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(dir);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_current_line()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_current_line", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_LINE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_set_current_line(QByteArray line)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_set_current_line", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_LINE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(line);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_del_current_line()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_del_current_line", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_DEL_CURRENT_LINE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_var(QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_var", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_vvar(QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_vvar", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_VVAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_option(QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_option", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_set_option(QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_set_option", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_SET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_out_write(QByteArray str)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_out_write", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_OUT_WRITE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(str);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_err_write(QByteArray str)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_err_write", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_ERR_WRITE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(str);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_report_error(QByteArray str)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_report_error", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_REPORT_ERROR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(str);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_buffers()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_buffers", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_BUFFERS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_current_buffer()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_current_buffer", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_BUFFER);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_set_current_buffer(int64_t buffer)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_set_current_buffer", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_BUFFER);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_windows()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_windows", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_WINDOWS);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_current_window()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_current_window", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_WINDOW);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_set_current_window(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_set_current_window", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_WINDOW);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_tabpages()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_tabpages", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_TABPAGES);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_current_tabpage()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_current_tabpage", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_TABPAGE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_set_current_tabpage(int64_t tabpage)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_set_current_tabpage", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_TABPAGE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_subscribe(QByteArray event)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_subscribe", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_SUBSCRIBE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(event);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_unsubscribe(QByteArray event)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_unsubscribe", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_UNSUBSCRIBE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(event);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_name_to_color(QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_name_to_color", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_NAME_TO_COLOR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_color_map()
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_color_map", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_COLOR_MAP);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_buffer(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_buffer", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_BUFFER);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_cursor(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_cursor", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_CURSOR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_set_cursor(int64_t window, QPoint pos)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_set_cursor", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_SET_CURSOR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(pos);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_height(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_height", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_HEIGHT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_set_height(int64_t window, int64_t height)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_set_height", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_SET_HEIGHT);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(height);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_width(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_width", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_WIDTH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_set_width(int64_t window, int64_t width)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_set_width", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_SET_WIDTH);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(width);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_var(int64_t window, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_VAR);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_option(int64_t window, QByteArray name)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_option", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_set_option(int64_t window, QByteArray name, QVariant value)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_set_option", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_SET_OPTION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_position(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_position", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_POSITION);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_tabpage(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_tabpage", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_TABPAGE);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_is_valid(int64_t window)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_IS_VALID);
+	connect(r, &MsgpackRequest::finished, this, &NeovimApi::handleResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+
+// Typed callbacks
+MsgpackRequest* NeovimApi::nvim_buf_line_count(int64_t buffer, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_line_count", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_LINE_COUNT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_line_count");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_line(int64_t buffer, int64_t index, std::function<void(QByteArray)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_line", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_LINE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QByteArray data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_line");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(index);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_attach(int64_t buffer, bool send_buffer, QVariantMap opts, std::function<void(bool)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_attach", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_ATTACH);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		bool data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_attach");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(send_buffer);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_detach(int64_t buffer, std::function<void(bool)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_detach", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_DETACH);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		bool data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_detach");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_line_slice(int64_t buffer, int64_t start, int64_t end, bool include_start, bool include_end, std::function<void(QList<QByteArray>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_line_slice", 5);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_LINE_SLICE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<QByteArray> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_line_slice");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(start);
+	m_c->m_dev->send(end);
+	m_c->m_dev->send(include_start);
+	m_c->m_dev->send(include_end);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_lines(int64_t buffer, int64_t start, int64_t end, bool strict_indexing, std::function<void(QList<QByteArray>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_lines", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_LINES);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<QByteArray> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_lines");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(start);
+	m_c->m_dev->send(end);
+	m_c->m_dev->send(strict_indexing);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_offset(int64_t buffer, int64_t index, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_offset", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OFFSET);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_offset");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(index);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_var(int64_t buffer, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_changedtick(int64_t buffer, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_changedtick", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_CHANGEDTICK);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_changedtick");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_keymap(int64_t buffer, QByteArray mode, std::function<void(QList<QVariantMap>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_keymap", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_KEYMAP);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<QVariantMap> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_keymap");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(mode);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_commands(int64_t buffer, QVariantMap opts, std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_commands", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_COMMANDS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_commands");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_set_var(int64_t buffer, QByteArray name, QVariant value, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_set_var", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_SET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_set_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_del_var(int64_t buffer, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_del_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_DEL_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_del_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_option(int64_t buffer, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_option", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OPTION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_option");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_number(int64_t buffer, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_number", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NUMBER);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_number");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_name(int64_t buffer, std::function<void(QByteArray)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_name", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NAME);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QByteArray data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_name");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_is_loaded(int64_t buffer, std::function<void(bool)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_is_loaded", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_IS_LOADED);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		bool data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_is_loaded");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_is_valid(int64_t buffer, std::function<void(bool)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_IS_VALID);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		bool data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_is_valid");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_get_mark(int64_t buffer, QByteArray name, std::function<void(QPoint)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_get_mark", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_GET_MARK);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QPoint data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_mark");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_add_highlight(int64_t buffer, int64_t ns_id, QByteArray hl_group, int64_t line, int64_t col_start, int64_t col_end, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_add_highlight", 6);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_ADD_HIGHLIGHT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_add_highlight");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(ns_id);
+	m_c->m_dev->send(hl_group);
+	m_c->m_dev->send(line);
+	m_c->m_dev->send(col_start);
+	m_c->m_dev->send(col_end);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_buf_set_virtual_text(int64_t buffer, int64_t ns_id, int64_t line, QVariantList chunks, QVariantMap opts, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_buf_set_virtual_text", 5);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_BUF_SET_VIRTUAL_TEXT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_set_virtual_text");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(ns_id);
+	m_c->m_dev->send(line);
+	m_c->m_dev->send(chunks);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_list_wins(int64_t tabpage, std::function<void(QList<int64_t>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_list_wins", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_LIST_WINS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<int64_t> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_tabpage_list_wins");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_get_var(int64_t tabpage, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_tabpage_get_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_set_var(int64_t tabpage, QByteArray name, QVariant value, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_set_var", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_SET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_set_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_del_var(int64_t tabpage, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_del_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_DEL_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_del_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_get_win(int64_t tabpage, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_get_win", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_WIN);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_tabpage_get_win");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_get_number(int64_t tabpage, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_get_number", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_NUMBER);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_tabpage_get_number");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_tabpage_is_valid(int64_t tabpage, std::function<void(bool)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_tabpage_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_TABPAGE_IS_VALID);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		bool data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_tabpage_is_valid");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_hl_by_name(QByteArray name, bool rgb, std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_hl_by_name", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_NAME);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_hl_by_name");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(rgb);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_hl_by_id(int64_t hl_id, bool rgb, std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_hl_by_id", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_ID);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_hl_by_id");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(hl_id);
+	m_c->m_dev->send(rgb);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_input(QByteArray keys, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_input", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_INPUT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_input");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(keys);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_replace_termcodes(QByteArray str, bool from_part, bool do_lt, bool special, std::function<void(QByteArray)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_replace_termcodes", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_REPLACE_TERMCODES);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QByteArray data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_replace_termcodes");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(str);
+	m_c->m_dev->send(from_part);
+	m_c->m_dev->send(do_lt);
+	m_c->m_dev->send(special);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_command_output(QByteArray command, std::function<void(QByteArray)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_command_output", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_COMMAND_OUTPUT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QByteArray data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_command_output");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(command);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_eval(QByteArray expr, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_eval", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_EVAL);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_eval");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(expr);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_execute_lua(QByteArray code, QVariantList args, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_execute_lua", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_EXECUTE_LUA);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_execute_lua");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(code);
+	m_c->m_dev->send(args);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_call_function(QByteArray fn, QVariantList args, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_call_function", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_CALL_FUNCTION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_call_function");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(fn);
+	m_c->m_dev->send(args);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_call_dict_function(QVariant dict, QByteArray fn, QVariantList args, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_call_dict_function", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_CALL_DICT_FUNCTION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_call_dict_function");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(dict);
+	m_c->m_dev->send(fn);
+	m_c->m_dev->send(args);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_strwidth(QByteArray text, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_strwidth", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_STRWIDTH);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_strwidth");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(text);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_runtime_paths(std::function<void(QList<QByteArray>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_runtime_paths", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_RUNTIME_PATHS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<QByteArray> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_runtime_paths");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_current_line(std::function<void(QByteArray)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_current_line", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_LINE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QByteArray data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_current_line");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_var(QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_var", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_set_var(QByteArray name, QVariant value, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_set_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_SET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_set_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_del_var(QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_del_var", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_DEL_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_del_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_vvar(QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_vvar", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_VVAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_vvar");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_option(QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_option", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_OPTION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_option");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_bufs(std::function<void(QList<int64_t>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_bufs", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_BUFS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<int64_t> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_bufs");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_current_buf(std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_current_buf", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_BUF);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_current_buf");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_wins(std::function<void(QList<int64_t>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_wins", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_WINS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<int64_t> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_wins");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_current_win(std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_current_win", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_WIN);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_current_win");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_create_buf(bool listed, bool scratch, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_create_buf", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_CREATE_BUF);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_create_buf");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(listed);
+	m_c->m_dev->send(scratch);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_open_win(int64_t buffer, bool enter, QVariantMap config, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_open_win", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_OPEN_WIN);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_open_win");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(enter);
+	m_c->m_dev->send(config);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_tabpages(std::function<void(QList<int64_t>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_tabpages", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_TABPAGES);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<int64_t> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_tabpages");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_current_tabpage(std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_current_tabpage", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_TABPAGE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_current_tabpage");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_create_namespace(QByteArray name, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_create_namespace", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_CREATE_NAMESPACE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_create_namespace");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_namespaces(std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_namespaces", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_NAMESPACES);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_namespaces");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_paste(QByteArray data, bool crlf, int64_t phase, std::function<void(bool)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_paste", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_PASTE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		bool data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_paste");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(data);
+	m_c->m_dev->send(crlf);
+	m_c->m_dev->send(phase);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_color_by_name(QByteArray name, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_color_by_name", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_BY_NAME);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_color_by_name");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_color_map(std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_color_map", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_MAP);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_color_map");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_context(QVariantMap opts, std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_context", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CONTEXT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_context");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_load_context(QVariantMap dict, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_load_context", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LOAD_CONTEXT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_load_context");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(dict);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_mode(std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_mode", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_MODE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_mode");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_keymap(QByteArray mode, std::function<void(QList<QVariantMap>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_keymap", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_KEYMAP);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<QVariantMap> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_keymap");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(mode);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_commands(QVariantMap opts, std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_commands", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_COMMANDS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_commands");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(opts);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_api_info(std::function<void(QVariantList)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_api_info", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_API_INFO);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantList data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_api_info");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_chan_info(int64_t chan, std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_chan_info", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_CHAN_INFO);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_chan_info");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(chan);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_chans(std::function<void(QVariantList)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_chans", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_CHANS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantList data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_chans");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_call_atomic(QVariantList calls, std::function<void(QVariantList)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_call_atomic", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_CALL_ATOMIC);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantList data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_call_atomic");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(calls);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_parse_expression(QByteArray expr, QByteArray flags, bool highlight, std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_parse_expression", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_PARSE_EXPRESSION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_parse_expression");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(expr);
+	m_c->m_dev->send(flags);
+	m_c->m_dev->send(highlight);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_list_uis(std::function<void(QVariantList)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_list_uis", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_LIST_UIS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantList data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_uis");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_proc_children(int64_t pid, std::function<void(QVariantList)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_proc_children", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_PROC_CHILDREN);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantList data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_proc_children");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(pid);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_get_proc(int64_t pid, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_get_proc", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_GET_PROC);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_proc");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(pid);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_buf(int64_t window, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_buf", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_BUF);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_buf");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_cursor(int64_t window, std::function<void(QPoint)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_cursor", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CURSOR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QPoint data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_cursor");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_height(int64_t window, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_height", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_HEIGHT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_height");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_width(int64_t window, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_width", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_WIDTH);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_width");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_var(int64_t window, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_set_var(int64_t window, QByteArray name, QVariant value, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_set_var", 3);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_SET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_set_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	m_c->m_dev->send(value);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_del_var(int64_t window, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_del_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_DEL_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_del_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_option(int64_t window, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_option", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_OPTION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_option");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_position(int64_t window, std::function<void(QPoint)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_position", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_POSITION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QPoint data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_position");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_tabpage(int64_t window, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_tabpage", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_TABPAGE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_tabpage");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_number(int64_t window, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_number", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_NUMBER);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_number");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_is_valid(int64_t window, std::function<void(bool)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_IS_VALID);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		bool data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_is_valid");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::nvim_win_get_config(int64_t window, std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("nvim_win_get_config", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CONFIG);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_config");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_line_count(int64_t buffer, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_line_count", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_LINE_COUNT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_line_count");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_lines(int64_t buffer, int64_t start, int64_t end, bool strict_indexing, std::function<void(QList<QByteArray>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_lines", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_LINES);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<QByteArray> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_lines");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(start);
+	m_c->m_dev->send(end);
+	m_c->m_dev->send(strict_indexing);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_var(int64_t buffer, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_option(int64_t buffer, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_option", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_OPTION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_option");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_number(int64_t buffer, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_number", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_NUMBER);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_number");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_name(int64_t buffer, std::function<void(QByteArray)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_name", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_NAME);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QByteArray data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_name");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_is_valid(int64_t buffer, std::function<void(bool)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_IS_VALID);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		bool data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_is_valid");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_get_mark(int64_t buffer, QByteArray name, std::function<void(QPoint)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_get_mark", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_GET_MARK);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QPoint data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_mark");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::buffer_add_highlight(int64_t buffer, int64_t ns_id, QByteArray hl_group, int64_t line, int64_t col_start, int64_t col_end, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("buffer_add_highlight", 6);
+	r->setFunction(NeovimApi::NEOVIM_FN_BUFFER_ADD_HIGHLIGHT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_add_highlight");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(buffer);
+	m_c->m_dev->send(ns_id);
+	m_c->m_dev->send(hl_group);
+	m_c->m_dev->send(line);
+	m_c->m_dev->send(col_start);
+	m_c->m_dev->send(col_end);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_get_windows(int64_t tabpage, std::function<void(QList<int64_t>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_get_windows", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOWS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<int64_t> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_get_windows");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_get_var(int64_t tabpage, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_GET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_get_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_get_window(int64_t tabpage, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_get_window", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOW);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_get_window");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::tabpage_is_valid(int64_t tabpage, std::function<void(bool)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("tabpage_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_TABPAGE_IS_VALID);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		bool data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_is_valid");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(tabpage);
+	return r;
+}
+MsgpackRequest* NeovimApi::ui_try_resize(int64_t width, int64_t height, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("ui_try_resize", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_UI_TRY_RESIZE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for ui_try_resize");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(width);
+	m_c->m_dev->send(height);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_input(QByteArray keys, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_input", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_INPUT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_input");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(keys);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_replace_termcodes(QByteArray str, bool from_part, bool do_lt, bool special, std::function<void(QByteArray)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_replace_termcodes", 4);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_REPLACE_TERMCODES);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QByteArray data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_replace_termcodes");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(str);
+	m_c->m_dev->send(from_part);
+	m_c->m_dev->send(do_lt);
+	m_c->m_dev->send(special);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_command_output(QByteArray command, std::function<void(QByteArray)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_command_output", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_COMMAND_OUTPUT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QByteArray data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_command_output");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(command);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_eval(QByteArray expr, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_eval", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_EVAL);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_eval");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(expr);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_call_function(QByteArray fn, QVariantList args, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_call_function", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_CALL_FUNCTION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_call_function");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(fn);
+	m_c->m_dev->send(args);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_strwidth(QByteArray text, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_strwidth", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_STRWIDTH);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_strwidth");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(text);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_list_runtime_paths(std::function<void(QList<QByteArray>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_list_runtime_paths", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_LIST_RUNTIME_PATHS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<QByteArray> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_list_runtime_paths");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_current_line(std::function<void(QByteArray)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_current_line", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_LINE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QByteArray data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_current_line");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_var(QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_var", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_vvar(QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_vvar", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_VVAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_vvar");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_option(QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_option", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_OPTION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_option");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_buffers(std::function<void(QList<int64_t>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_buffers", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_BUFFERS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<int64_t> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_buffers");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_current_buffer(std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_current_buffer", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_BUFFER);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_current_buffer");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_windows(std::function<void(QList<int64_t>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_windows", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_WINDOWS);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<int64_t> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_windows");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_current_window(std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_current_window", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_WINDOW);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_current_window");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_tabpages(std::function<void(QList<int64_t>)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_tabpages", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_TABPAGES);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QList<int64_t> data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_tabpages");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_current_tabpage(std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_current_tabpage", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_TABPAGE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_current_tabpage");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_name_to_color(QByteArray name, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_name_to_color", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_NAME_TO_COLOR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_name_to_color");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::vim_get_color_map(std::function<void(QVariantMap)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("vim_get_color_map", 0);
+	r->setFunction(NeovimApi::NEOVIM_FN_VIM_GET_COLOR_MAP);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariantMap data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_color_map");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_buffer(int64_t window, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_buffer", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_BUFFER);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_buffer");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_cursor(int64_t window, std::function<void(QPoint)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_cursor", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_CURSOR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QPoint data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_cursor");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_height(int64_t window, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_height", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_HEIGHT);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_height");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_width(int64_t window, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_width", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_WIDTH);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_width");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_var(int64_t window, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_var", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_VAR);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_var");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_option(int64_t window, QByteArray name, std::function<void(QVariant)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_option", 2);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_OPTION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QVariant data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_option");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	m_c->m_dev->send(name);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_position(int64_t window, std::function<void(QPoint)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_position", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_POSITION);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		QPoint data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_position");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_get_tabpage(int64_t window, std::function<void(int64_t)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_get_tabpage", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_GET_TABPAGE);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		int64_t data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_tabpage");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+MsgpackRequest* NeovimApi::window_is_valid(int64_t window, std::function<void(bool)> callback)
+{
+	MsgpackRequest *r = m_c->m_dev->startRequestUnchecked("window_is_valid", 1);
+	r->setFunction(NeovimApi::NEOVIM_FN_WINDOW_IS_VALID);
+	r->setResultDecoder([this, callback](MsgpackIODevice *dev, const msgpack_object& res) {
+		bool data;
+		if (dev->decodeMsgpack(res, data)) {
+			m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_is_valid");
+			return true;
+		}
+		callback(data);
+		return false;
+	});
+	connect(r, &MsgpackRequest::error, this, &NeovimApi::handleResponseError);
+	m_c->m_dev->send(window);
+	return r;
+}
+
+// Handlers
+
+void NeovimApi::handleResponseError(quint32 msgid, quint64 fun, const QVariant& res)
+{
+
+	// TODO: support Neovim error types Exception/Validation/etc
+	QString errMsg;
+	const QVariantList asList = res.toList();
+	if (asList.size() >= 2) {
+		if (asList.at(1).canConvert<QByteArray>()) {
+			errMsg = m_c->m_dev->decode(asList.at(1).toByteArray());
+		} else {
+			errMsg = tr("Received unsupported Neovim error type");
+		}
+	}
+
+	switch(fun) {
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_LINE_COUNT:
+		emit err_nvim_buf_line_count(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_LINE:
+		emit err_buffer_get_line(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_ATTACH:
+		emit err_nvim_buf_attach(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_DETACH:
+		emit err_nvim_buf_detach(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_LINE:
+		emit err_buffer_set_line(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_DEL_LINE:
+		emit err_buffer_del_line(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_LINE_SLICE:
+		emit err_buffer_get_line_slice(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_LINES:
+		emit err_nvim_buf_get_lines(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_LINE_SLICE:
+		emit err_buffer_set_line_slice(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_LINES:
+		emit err_nvim_buf_set_lines(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OFFSET:
+		emit err_nvim_buf_get_offset(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_VAR:
+		emit err_nvim_buf_get_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_CHANGEDTICK:
+		emit err_nvim_buf_get_changedtick(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_KEYMAP:
+		emit err_nvim_buf_get_keymap(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_KEYMAP:
+		emit err_nvim_buf_set_keymap(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_DEL_KEYMAP:
+		emit err_nvim_buf_del_keymap(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_COMMANDS:
+		emit err_nvim_buf_get_commands(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_VAR:
+		emit err_nvim_buf_set_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_DEL_VAR:
+		emit err_nvim_buf_del_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_VAR:
+		emit err_buffer_set_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_DEL_VAR:
+		emit err_buffer_del_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OPTION:
+		emit err_nvim_buf_get_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_OPTION:
+		emit err_nvim_buf_set_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NUMBER:
+		emit err_nvim_buf_get_number(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NAME:
+		emit err_nvim_buf_get_name(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_NAME:
+		emit err_nvim_buf_set_name(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_IS_LOADED:
+		emit err_nvim_buf_is_loaded(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_IS_VALID:
+		emit err_nvim_buf_is_valid(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_INSERT:
+		emit err_buffer_insert(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_MARK:
+		emit err_nvim_buf_get_mark(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_ADD_HIGHLIGHT:
+		emit err_nvim_buf_add_highlight(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_CLEAR_NAMESPACE:
+		emit err_nvim_buf_clear_namespace(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_CLEAR_HIGHLIGHT:
+		emit err_nvim_buf_clear_highlight(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_VIRTUAL_TEXT:
+		emit err_nvim_buf_set_virtual_text(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_LIST_WINS:
+		emit err_nvim_tabpage_list_wins(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_VAR:
+		emit err_nvim_tabpage_get_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_SET_VAR:
+		emit err_nvim_tabpage_set_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_DEL_VAR:
+		emit err_nvim_tabpage_del_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_SET_VAR:
+		emit err_tabpage_set_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_DEL_VAR:
+		emit err_tabpage_del_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_WIN:
+		emit err_nvim_tabpage_get_win(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_NUMBER:
+		emit err_nvim_tabpage_get_number(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_IS_VALID:
+		emit err_nvim_tabpage_is_valid(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_ATTACH:
+		emit err_nvim_ui_attach(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_UI_ATTACH:
+		emit err_ui_attach(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_DETACH:
+		emit err_nvim_ui_detach(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_TRY_RESIZE:
+		emit err_nvim_ui_try_resize(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_SET_OPTION:
+		emit err_nvim_ui_set_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_TRY_RESIZE_GRID:
+		emit err_nvim_ui_try_resize_grid(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_PUM_SET_HEIGHT:
+		emit err_nvim_ui_pum_set_height(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_COMMAND:
+		emit err_nvim_command(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_NAME:
+		emit err_nvim_get_hl_by_name(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_ID:
+		emit err_nvim_get_hl_by_id(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_FEEDKEYS:
+		emit err_nvim_feedkeys(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_INPUT:
+		emit err_nvim_input(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_INPUT_MOUSE:
+		emit err_nvim_input_mouse(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_REPLACE_TERMCODES:
+		emit err_nvim_replace_termcodes(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_COMMAND_OUTPUT:
+		emit err_nvim_command_output(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_EVAL:
+		emit err_nvim_eval(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_EXECUTE_LUA:
+		emit err_nvim_execute_lua(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_CALL_FUNCTION:
+		emit err_nvim_call_function(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_CALL_DICT_FUNCTION:
+		emit err_nvim_call_dict_function(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_STRWIDTH:
+		emit err_nvim_strwidth(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_RUNTIME_PATHS:
+		emit err_nvim_list_runtime_paths(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_DIR:
+		emit err_nvim_set_current_dir(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_LINE:
+		emit err_nvim_get_current_line(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_LINE:
+		emit err_nvim_set_current_line(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_DEL_CURRENT_LINE:
+		emit err_nvim_del_current_line(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_VAR:
+		emit err_nvim_get_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_VAR:
+		emit err_nvim_set_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_DEL_VAR:
+		emit err_nvim_del_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_VAR:
+		emit err_vim_set_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_DEL_VAR:
+		emit err_vim_del_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_VVAR:
+		emit err_nvim_get_vvar(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_VVAR:
+		emit err_nvim_set_vvar(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_OPTION:
+		emit err_nvim_get_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_OPTION:
+		emit err_nvim_set_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_OUT_WRITE:
+		emit err_nvim_out_write(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_ERR_WRITE:
+		emit err_nvim_err_write(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_ERR_WRITELN:
+		emit err_nvim_err_writeln(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_BUFS:
+		emit err_nvim_list_bufs(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_BUF:
+		emit err_nvim_get_current_buf(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_BUF:
+		emit err_nvim_set_current_buf(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_WINS:
+		emit err_nvim_list_wins(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_WIN:
+		emit err_nvim_get_current_win(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_WIN:
+		emit err_nvim_set_current_win(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_CREATE_BUF:
+		emit err_nvim_create_buf(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_OPEN_WIN:
+		emit err_nvim_open_win(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_TABPAGES:
+		emit err_nvim_list_tabpages(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_TABPAGE:
+		emit err_nvim_get_current_tabpage(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_TABPAGE:
+		emit err_nvim_set_current_tabpage(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_CREATE_NAMESPACE:
+		emit err_nvim_create_namespace(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_NAMESPACES:
+		emit err_nvim_get_namespaces(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_PASTE:
+		emit err_nvim_paste(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_PUT:
+		emit err_nvim_put(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SUBSCRIBE:
+		emit err_nvim_subscribe(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UNSUBSCRIBE:
+		emit err_nvim_unsubscribe(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_BY_NAME:
+		emit err_nvim_get_color_by_name(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_MAP:
+		emit err_nvim_get_color_map(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CONTEXT:
+		emit err_nvim_get_context(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LOAD_CONTEXT:
+		emit err_nvim_load_context(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_MODE:
+		emit err_nvim_get_mode(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_KEYMAP:
+		emit err_nvim_get_keymap(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_KEYMAP:
+		emit err_nvim_set_keymap(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_DEL_KEYMAP:
+		emit err_nvim_del_keymap(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_COMMANDS:
+		emit err_nvim_get_commands(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_API_INFO:
+		emit err_nvim_get_api_info(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CLIENT_INFO:
+		emit err_nvim_set_client_info(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CHAN_INFO:
+		emit err_nvim_get_chan_info(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_CHANS:
+		emit err_nvim_list_chans(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_CALL_ATOMIC:
+		emit err_nvim_call_atomic(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_PARSE_EXPRESSION:
+		emit err_nvim_parse_expression(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_UIS:
+		emit err_nvim_list_uis(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_PROC_CHILDREN:
+		emit err_nvim_get_proc_children(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_PROC:
+		emit err_nvim_get_proc(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SELECT_POPUPMENU_ITEM:
+		emit err_nvim_select_popupmenu_item(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_BUF:
+		emit err_nvim_win_get_buf(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_BUF:
+		emit err_nvim_win_set_buf(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CURSOR:
+		emit err_nvim_win_get_cursor(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_CURSOR:
+		emit err_nvim_win_set_cursor(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_HEIGHT:
+		emit err_nvim_win_get_height(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_HEIGHT:
+		emit err_nvim_win_set_height(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_WIDTH:
+		emit err_nvim_win_get_width(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_WIDTH:
+		emit err_nvim_win_set_width(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_VAR:
+		emit err_nvim_win_get_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_VAR:
+		emit err_nvim_win_set_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_DEL_VAR:
+		emit err_nvim_win_del_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_VAR:
+		emit err_window_set_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_DEL_VAR:
+		emit err_window_del_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_OPTION:
+		emit err_nvim_win_get_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_OPTION:
+		emit err_nvim_win_set_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_POSITION:
+		emit err_nvim_win_get_position(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_TABPAGE:
+		emit err_nvim_win_get_tabpage(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_NUMBER:
+		emit err_nvim_win_get_number(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_IS_VALID:
+		emit err_nvim_win_is_valid(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_CONFIG:
+		emit err_nvim_win_set_config(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CONFIG:
+		emit err_nvim_win_get_config(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_CLOSE:
+		emit err_nvim_win_close(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_LINE_COUNT:
+		emit err_buffer_line_count(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_LINES:
+		emit err_buffer_get_lines(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_LINES:
+		emit err_buffer_set_lines(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_VAR:
+		emit err_buffer_get_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_OPTION:
+		emit err_buffer_get_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_OPTION:
+		emit err_buffer_set_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_NUMBER:
+		emit err_buffer_get_number(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_NAME:
+		emit err_buffer_get_name(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_NAME:
+		emit err_buffer_set_name(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_IS_VALID:
+		emit err_buffer_is_valid(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_MARK:
+		emit err_buffer_get_mark(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_ADD_HIGHLIGHT:
+		emit err_buffer_add_highlight(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_CLEAR_HIGHLIGHT:
+		emit err_buffer_clear_highlight(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOWS:
+		emit err_tabpage_get_windows(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_GET_VAR:
+		emit err_tabpage_get_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOW:
+		emit err_tabpage_get_window(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_IS_VALID:
+		emit err_tabpage_is_valid(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_UI_DETACH:
+		emit err_ui_detach(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_UI_TRY_RESIZE:
+		emit err_ui_try_resize(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_COMMAND:
+		emit err_vim_command(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_FEEDKEYS:
+		emit err_vim_feedkeys(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_INPUT:
+		emit err_vim_input(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_REPLACE_TERMCODES:
+		emit err_vim_replace_termcodes(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_COMMAND_OUTPUT:
+		emit err_vim_command_output(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_EVAL:
+		emit err_vim_eval(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_CALL_FUNCTION:
+		emit err_vim_call_function(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_STRWIDTH:
+		emit err_vim_strwidth(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_LIST_RUNTIME_PATHS:
+		emit err_vim_list_runtime_paths(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_CHANGE_DIRECTORY:
+		emit err_vim_change_directory(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_LINE:
+		emit err_vim_get_current_line(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_LINE:
+		emit err_vim_set_current_line(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_DEL_CURRENT_LINE:
+		emit err_vim_del_current_line(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_VAR:
+		emit err_vim_get_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_VVAR:
+		emit err_vim_get_vvar(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_OPTION:
+		emit err_vim_get_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_OPTION:
+		emit err_vim_set_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_OUT_WRITE:
+		emit err_vim_out_write(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_ERR_WRITE:
+		emit err_vim_err_write(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_REPORT_ERROR:
+		emit err_vim_report_error(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_BUFFERS:
+		emit err_vim_get_buffers(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_BUFFER:
+		emit err_vim_get_current_buffer(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_BUFFER:
+		emit err_vim_set_current_buffer(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_WINDOWS:
+		emit err_vim_get_windows(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_WINDOW:
+		emit err_vim_get_current_window(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_WINDOW:
+		emit err_vim_set_current_window(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_TABPAGES:
+		emit err_vim_get_tabpages(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_TABPAGE:
+		emit err_vim_get_current_tabpage(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_TABPAGE:
+		emit err_vim_set_current_tabpage(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SUBSCRIBE:
+		emit err_vim_subscribe(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_UNSUBSCRIBE:
+		emit err_vim_unsubscribe(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_NAME_TO_COLOR:
+		emit err_vim_name_to_color(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_COLOR_MAP:
+		emit err_vim_get_color_map(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_BUFFER:
+		emit err_window_get_buffer(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_CURSOR:
+		emit err_window_get_cursor(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_CURSOR:
+		emit err_window_set_cursor(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_HEIGHT:
+		emit err_window_get_height(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_HEIGHT:
+		emit err_window_set_height(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_WIDTH:
+		emit err_window_get_width(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_WIDTH:
+		emit err_window_set_width(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_VAR:
+		emit err_window_get_var(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_OPTION:
+		emit err_window_get_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_OPTION:
+		emit err_window_set_option(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_POSITION:
+		emit err_window_get_position(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_TABPAGE:
+		emit err_window_get_tabpage(errMsg, res);
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_IS_VALID:
+		emit err_window_is_valid(errMsg, res);
+		break;
+	default:
+		m_c->setError(NeovimConnector::RuntimeMsgpackError, QString("Received error for function that should not fail: %s").arg(fun));
+	}
+}
+
+void NeovimApi::handleResponse(quint32 msgid, quint64 fun, const QVariant& res)
+{
+	switch(fun) {
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_LINE_COUNT:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_line_count");
+				return;
+			} else {
+				emit on_nvim_buf_line_count(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_LINE:
+		{
+			QByteArray data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_line");
+				return;
+			} else {
+				emit on_buffer_get_line(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_ATTACH:
+		{
+			bool data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_attach");
+				return;
+			} else {
+				emit on_nvim_buf_attach(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_DETACH:
+		{
+			bool data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_detach");
+				return;
+			} else {
+				emit on_nvim_buf_detach(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_LINE:
+		{
+			emit on_buffer_set_line();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_DEL_LINE:
+		{
+			emit on_buffer_del_line();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_LINE_SLICE:
+		{
+			QList<QByteArray> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_line_slice");
+				return;
+			} else {
+				emit on_buffer_get_line_slice(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_LINES:
+		{
+			QList<QByteArray> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_lines");
+				return;
+			} else {
+				emit on_nvim_buf_get_lines(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_LINE_SLICE:
+		{
+			emit on_buffer_set_line_slice();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_LINES:
+		{
+			emit on_nvim_buf_set_lines();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OFFSET:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_offset");
+				return;
+			} else {
+				emit on_nvim_buf_get_offset(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_var");
+				return;
+			} else {
+				emit on_nvim_buf_get_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_CHANGEDTICK:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_changedtick");
+				return;
+			} else {
+				emit on_nvim_buf_get_changedtick(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_KEYMAP:
+		{
+			QList<QVariantMap> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_keymap");
+				return;
+			} else {
+				emit on_nvim_buf_get_keymap(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_KEYMAP:
+		{
+			emit on_nvim_buf_set_keymap();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_DEL_KEYMAP:
+		{
+			emit on_nvim_buf_del_keymap();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_COMMANDS:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_commands");
+				return;
+			} else {
+				emit on_nvim_buf_get_commands(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_VAR:
+		{
+			emit on_nvim_buf_set_var();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_DEL_VAR:
+		{
+			emit on_nvim_buf_del_var();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_set_var");
+				return;
+			} else {
+				emit on_buffer_set_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_DEL_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_del_var");
+				return;
+			} else {
+				emit on_buffer_del_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OPTION:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_option");
+				return;
+			} else {
+				emit on_nvim_buf_get_option(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_OPTION:
+		{
+			emit on_nvim_buf_set_option();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NUMBER:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_number");
+				return;
+			} else {
+				emit on_nvim_buf_get_number(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NAME:
+		{
+			QByteArray data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_name");
+				return;
+			} else {
+				emit on_nvim_buf_get_name(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_NAME:
+		{
+			emit on_nvim_buf_set_name();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_IS_LOADED:
+		{
+			bool data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_is_loaded");
+				return;
+			} else {
+				emit on_nvim_buf_is_loaded(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_IS_VALID:
+		{
+			bool data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_is_valid");
+				return;
+			} else {
+				emit on_nvim_buf_is_valid(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_INSERT:
+		{
+			emit on_buffer_insert();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_MARK:
+		{
+			QPoint data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_get_mark");
+				return;
+			} else {
+				emit on_nvim_buf_get_mark(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_ADD_HIGHLIGHT:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_add_highlight");
+				return;
+			} else {
+				emit on_nvim_buf_add_highlight(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_CLEAR_NAMESPACE:
+		{
+			emit on_nvim_buf_clear_namespace();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_CLEAR_HIGHLIGHT:
+		{
+			emit on_nvim_buf_clear_highlight();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_VIRTUAL_TEXT:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_buf_set_virtual_text");
+				return;
+			} else {
+				emit on_nvim_buf_set_virtual_text(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_LIST_WINS:
+		{
+			QList<int64_t> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_tabpage_list_wins");
+				return;
+			} else {
+				emit on_nvim_tabpage_list_wins(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_tabpage_get_var");
+				return;
+			} else {
+				emit on_nvim_tabpage_get_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_SET_VAR:
+		{
+			emit on_nvim_tabpage_set_var();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_DEL_VAR:
+		{
+			emit on_nvim_tabpage_del_var();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_SET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_set_var");
+				return;
+			} else {
+				emit on_tabpage_set_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_DEL_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_del_var");
+				return;
+			} else {
+				emit on_tabpage_del_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_WIN:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_tabpage_get_win");
+				return;
+			} else {
+				emit on_nvim_tabpage_get_win(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_NUMBER:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_tabpage_get_number");
+				return;
+			} else {
+				emit on_nvim_tabpage_get_number(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_IS_VALID:
+		{
+			bool data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_tabpage_is_valid");
+				return;
+			} else {
+				emit on_nvim_tabpage_is_valid(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_ATTACH:
+		{
+			emit on_nvim_ui_attach();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_UI_ATTACH:
+		{
+			emit on_ui_attach();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_DETACH:
+		{
+			emit on_nvim_ui_detach();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_TRY_RESIZE:
+		{
+			emit on_nvim_ui_try_resize();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_SET_OPTION:
+		{
+			emit on_nvim_ui_set_option();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_TRY_RESIZE_GRID:
+		{
+			emit on_nvim_ui_try_resize_grid();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UI_PUM_SET_HEIGHT:
+		{
+			emit on_nvim_ui_pum_set_height();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_COMMAND:
+		{
+			emit on_nvim_command();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_NAME:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_hl_by_name");
+				return;
+			} else {
+				emit on_nvim_get_hl_by_name(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_ID:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_hl_by_id");
+				return;
+			} else {
+				emit on_nvim_get_hl_by_id(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_FEEDKEYS:
+		{
+			emit on_nvim_feedkeys();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_INPUT:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_input");
+				return;
+			} else {
+				emit on_nvim_input(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_INPUT_MOUSE:
+		{
+			emit on_nvim_input_mouse();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_REPLACE_TERMCODES:
+		{
+			QByteArray data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_replace_termcodes");
+				return;
+			} else {
+				emit on_nvim_replace_termcodes(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_COMMAND_OUTPUT:
+		{
+			QByteArray data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_command_output");
+				return;
+			} else {
+				emit on_nvim_command_output(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_EVAL:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_eval");
+				return;
+			} else {
+				emit on_nvim_eval(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_EXECUTE_LUA:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_execute_lua");
+				return;
+			} else {
+				emit on_nvim_execute_lua(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_CALL_FUNCTION:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_call_function");
+				return;
+			} else {
+				emit on_nvim_call_function(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_CALL_DICT_FUNCTION:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_call_dict_function");
+				return;
+			} else {
+				emit on_nvim_call_dict_function(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_STRWIDTH:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_strwidth");
+				return;
+			} else {
+				emit on_nvim_strwidth(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_RUNTIME_PATHS:
+		{
+			QList<QByteArray> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_runtime_paths");
+				return;
+			} else {
+				emit on_nvim_list_runtime_paths(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_DIR:
+		{
+			emit on_nvim_set_current_dir();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_LINE:
+		{
+			QByteArray data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_current_line");
+				return;
+			} else {
+				emit on_nvim_get_current_line(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_LINE:
+		{
+			emit on_nvim_set_current_line();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_DEL_CURRENT_LINE:
+		{
+			emit on_nvim_del_current_line();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_var");
+				return;
+			} else {
+				emit on_nvim_get_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_VAR:
+		{
+			emit on_nvim_set_var();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_DEL_VAR:
+		{
+			emit on_nvim_del_var();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_set_var");
+				return;
+			} else {
+				emit on_vim_set_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_DEL_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_del_var");
+				return;
+			} else {
+				emit on_vim_del_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_VVAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_vvar");
+				return;
+			} else {
+				emit on_nvim_get_vvar(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_VVAR:
+		{
+			emit on_nvim_set_vvar();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_OPTION:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_option");
+				return;
+			} else {
+				emit on_nvim_get_option(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_OPTION:
+		{
+			emit on_nvim_set_option();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_OUT_WRITE:
+		{
+			emit on_nvim_out_write();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_ERR_WRITE:
+		{
+			emit on_nvim_err_write();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_ERR_WRITELN:
+		{
+			emit on_nvim_err_writeln();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_BUFS:
+		{
+			QList<int64_t> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_bufs");
+				return;
+			} else {
+				emit on_nvim_list_bufs(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_BUF:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_current_buf");
+				return;
+			} else {
+				emit on_nvim_get_current_buf(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_BUF:
+		{
+			emit on_nvim_set_current_buf();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_WINS:
+		{
+			QList<int64_t> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_wins");
+				return;
+			} else {
+				emit on_nvim_list_wins(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_WIN:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_current_win");
+				return;
+			} else {
+				emit on_nvim_get_current_win(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_WIN:
+		{
+			emit on_nvim_set_current_win();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_CREATE_BUF:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_create_buf");
+				return;
+			} else {
+				emit on_nvim_create_buf(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_OPEN_WIN:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_open_win");
+				return;
+			} else {
+				emit on_nvim_open_win(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_TABPAGES:
+		{
+			QList<int64_t> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_tabpages");
+				return;
+			} else {
+				emit on_nvim_list_tabpages(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_TABPAGE:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_current_tabpage");
+				return;
+			} else {
+				emit on_nvim_get_current_tabpage(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_TABPAGE:
+		{
+			emit on_nvim_set_current_tabpage();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_CREATE_NAMESPACE:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_create_namespace");
+				return;
+			} else {
+				emit on_nvim_create_namespace(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_NAMESPACES:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_namespaces");
+				return;
+			} else {
+				emit on_nvim_get_namespaces(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_PASTE:
+		{
+			bool data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_paste");
+				return;
+			} else {
+				emit on_nvim_paste(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_PUT:
+		{
+			emit on_nvim_put();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SUBSCRIBE:
+		{
+			emit on_nvim_subscribe();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_UNSUBSCRIBE:
+		{
+			emit on_nvim_unsubscribe();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_BY_NAME:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_color_by_name");
+				return;
+			} else {
+				emit on_nvim_get_color_by_name(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_MAP:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_color_map");
+				return;
+			} else {
+				emit on_nvim_get_color_map(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CONTEXT:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_context");
+				return;
+			} else {
+				emit on_nvim_get_context(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LOAD_CONTEXT:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_load_context");
+				return;
+			} else {
+				emit on_nvim_load_context(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_MODE:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_mode");
+				return;
+			} else {
+				emit on_nvim_get_mode(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_KEYMAP:
+		{
+			QList<QVariantMap> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_keymap");
+				return;
+			} else {
+				emit on_nvim_get_keymap(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_KEYMAP:
+		{
+			emit on_nvim_set_keymap();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_DEL_KEYMAP:
+		{
+			emit on_nvim_del_keymap();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_COMMANDS:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_commands");
+				return;
+			} else {
+				emit on_nvim_get_commands(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_API_INFO:
+		{
+			QVariantList data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_api_info");
+				return;
+			} else {
+				emit on_nvim_get_api_info(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CLIENT_INFO:
+		{
+			emit on_nvim_set_client_info();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CHAN_INFO:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_chan_info");
+				return;
+			} else {
+				emit on_nvim_get_chan_info(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_CHANS:
+		{
+			QVariantList data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_chans");
+				return;
+			} else {
+				emit on_nvim_list_chans(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_CALL_ATOMIC:
+		{
+			QVariantList data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_call_atomic");
+				return;
+			} else {
+				emit on_nvim_call_atomic(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_PARSE_EXPRESSION:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_parse_expression");
+				return;
+			} else {
+				emit on_nvim_parse_expression(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_UIS:
+		{
+			QVariantList data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_list_uis");
+				return;
+			} else {
+				emit on_nvim_list_uis(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_PROC_CHILDREN:
+		{
+			QVariantList data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_proc_children");
+				return;
+			} else {
+				emit on_nvim_get_proc_children(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_GET_PROC:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_get_proc");
+				return;
+			} else {
+				emit on_nvim_get_proc(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_SELECT_POPUPMENU_ITEM:
+		{
+			emit on_nvim_select_popupmenu_item();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_BUF:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_buf");
+				return;
+			} else {
+				emit on_nvim_win_get_buf(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_BUF:
+		{
+			emit on_nvim_win_set_buf();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CURSOR:
+		{
+			QPoint data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_cursor");
+				return;
+			} else {
+				emit on_nvim_win_get_cursor(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_CURSOR:
+		{
+			emit on_nvim_win_set_cursor();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_HEIGHT:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_height");
+				return;
+			} else {
+				emit on_nvim_win_get_height(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_HEIGHT:
+		{
+			emit on_nvim_win_set_height();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_WIDTH:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_width");
+				return;
+			} else {
+				emit on_nvim_win_get_width(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_WIDTH:
+		{
+			emit on_nvim_win_set_width();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_var");
+				return;
+			} else {
+				emit on_nvim_win_get_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_VAR:
+		{
+			emit on_nvim_win_set_var();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_DEL_VAR:
+		{
+			emit on_nvim_win_del_var();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_set_var");
+				return;
+			} else {
+				emit on_window_set_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_DEL_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_del_var");
+				return;
+			} else {
+				emit on_window_del_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_OPTION:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_option");
+				return;
+			} else {
+				emit on_nvim_win_get_option(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_OPTION:
+		{
+			emit on_nvim_win_set_option();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_POSITION:
+		{
+			QPoint data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_position");
+				return;
+			} else {
+				emit on_nvim_win_get_position(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_TABPAGE:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_tabpage");
+				return;
+			} else {
+				emit on_nvim_win_get_tabpage(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_NUMBER:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_number");
+				return;
+			} else {
+				emit on_nvim_win_get_number(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_IS_VALID:
+		{
+			bool data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_is_valid");
+				return;
+			} else {
+				emit on_nvim_win_is_valid(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_CONFIG:
+		{
+			emit on_nvim_win_set_config();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CONFIG:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for nvim_win_get_config");
+				return;
+			} else {
+				emit on_nvim_win_get_config(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_CLOSE:
+		{
+			emit on_nvim_win_close();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_LINE_COUNT:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_line_count");
+				return;
+			} else {
+				emit on_buffer_line_count(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_LINES:
+		{
+			QList<QByteArray> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_lines");
+				return;
+			} else {
+				emit on_buffer_get_lines(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_LINES:
+		{
+			emit on_buffer_set_lines();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_var");
+				return;
+			} else {
+				emit on_buffer_get_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_OPTION:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_option");
+				return;
+			} else {
+				emit on_buffer_get_option(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_OPTION:
+		{
+			emit on_buffer_set_option();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_NUMBER:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_number");
+				return;
+			} else {
+				emit on_buffer_get_number(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_NAME:
+		{
+			QByteArray data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_name");
+				return;
+			} else {
+				emit on_buffer_get_name(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_NAME:
+		{
+			emit on_buffer_set_name();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_IS_VALID:
+		{
+			bool data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_is_valid");
+				return;
+			} else {
+				emit on_buffer_is_valid(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_MARK:
+		{
+			QPoint data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_get_mark");
+				return;
+			} else {
+				emit on_buffer_get_mark(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_ADD_HIGHLIGHT:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for buffer_add_highlight");
+				return;
+			} else {
+				emit on_buffer_add_highlight(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_BUFFER_CLEAR_HIGHLIGHT:
+		{
+			emit on_buffer_clear_highlight();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOWS:
+		{
+			QList<int64_t> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_get_windows");
+				return;
+			} else {
+				emit on_tabpage_get_windows(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_GET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_get_var");
+				return;
+			} else {
+				emit on_tabpage_get_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOW:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_get_window");
+				return;
+			} else {
+				emit on_tabpage_get_window(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_TABPAGE_IS_VALID:
+		{
+			bool data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for tabpage_is_valid");
+				return;
+			} else {
+				emit on_tabpage_is_valid(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_UI_DETACH:
+		{
+			emit on_ui_detach();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_UI_TRY_RESIZE:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for ui_try_resize");
+				return;
+			} else {
+				emit on_ui_try_resize(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_COMMAND:
+		{
+			emit on_vim_command();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_FEEDKEYS:
+		{
+			emit on_vim_feedkeys();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_INPUT:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_input");
+				return;
+			} else {
+				emit on_vim_input(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_REPLACE_TERMCODES:
+		{
+			QByteArray data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_replace_termcodes");
+				return;
+			} else {
+				emit on_vim_replace_termcodes(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_COMMAND_OUTPUT:
+		{
+			QByteArray data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_command_output");
+				return;
+			} else {
+				emit on_vim_command_output(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_EVAL:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_eval");
+				return;
+			} else {
+				emit on_vim_eval(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_CALL_FUNCTION:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_call_function");
+				return;
+			} else {
+				emit on_vim_call_function(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_STRWIDTH:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_strwidth");
+				return;
+			} else {
+				emit on_vim_strwidth(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_LIST_RUNTIME_PATHS:
+		{
+			QList<QByteArray> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_list_runtime_paths");
+				return;
+			} else {
+				emit on_vim_list_runtime_paths(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_CHANGE_DIRECTORY:
+		{
+			emit on_vim_change_directory();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_LINE:
+		{
+			QByteArray data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_current_line");
+				return;
+			} else {
+				emit on_vim_get_current_line(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_LINE:
+		{
+			emit on_vim_set_current_line();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_DEL_CURRENT_LINE:
+		{
+			emit on_vim_del_current_line();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_var");
+				return;
+			} else {
+				emit on_vim_get_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_VVAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_vvar");
+				return;
+			} else {
+				emit on_vim_get_vvar(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_OPTION:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_option");
+				return;
+			} else {
+				emit on_vim_get_option(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_OPTION:
+		{
+			emit on_vim_set_option();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_OUT_WRITE:
+		{
+			emit on_vim_out_write();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_ERR_WRITE:
+		{
+			emit on_vim_err_write();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_REPORT_ERROR:
+		{
+			emit on_vim_report_error();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_BUFFERS:
+		{
+			QList<int64_t> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_buffers");
+				return;
+			} else {
+				emit on_vim_get_buffers(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_BUFFER:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_current_buffer");
+				return;
+			} else {
+				emit on_vim_get_current_buffer(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_BUFFER:
+		{
+			emit on_vim_set_current_buffer();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_WINDOWS:
+		{
+			QList<int64_t> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_windows");
+				return;
+			} else {
+				emit on_vim_get_windows(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_WINDOW:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_current_window");
+				return;
+			} else {
+				emit on_vim_get_current_window(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_WINDOW:
+		{
+			emit on_vim_set_current_window();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_TABPAGES:
+		{
+			QList<int64_t> data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_tabpages");
+				return;
+			} else {
+				emit on_vim_get_tabpages(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_TABPAGE:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_current_tabpage");
+				return;
+			} else {
+				emit on_vim_get_current_tabpage(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_TABPAGE:
+		{
+			emit on_vim_set_current_tabpage();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_SUBSCRIBE:
+		{
+			emit on_vim_subscribe();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_UNSUBSCRIBE:
+		{
+			emit on_vim_unsubscribe();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_NAME_TO_COLOR:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_name_to_color");
+				return;
+			} else {
+				emit on_vim_name_to_color(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_VIM_GET_COLOR_MAP:
+		{
+			QVariantMap data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for vim_get_color_map");
+				return;
+			} else {
+				emit on_vim_get_color_map(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_BUFFER:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_buffer");
+				return;
+			} else {
+				emit on_window_get_buffer(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_CURSOR:
+		{
+			QPoint data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_cursor");
+				return;
+			} else {
+				emit on_window_get_cursor(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_CURSOR:
+		{
+			emit on_window_set_cursor();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_HEIGHT:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_height");
+				return;
+			} else {
+				emit on_window_get_height(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_HEIGHT:
+		{
+			emit on_window_set_height();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_WIDTH:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_width");
+				return;
+			} else {
+				emit on_window_get_width(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_WIDTH:
+		{
+			emit on_window_set_width();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_VAR:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_var");
+				return;
+			} else {
+				emit on_window_get_var(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_OPTION:
+		{
+			QVariant data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_option");
+				return;
+			} else {
+				emit on_window_get_option(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_OPTION:
+		{
+			emit on_window_set_option();
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_POSITION:
+		{
+			QPoint data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_position");
+				return;
+			} else {
+				emit on_window_get_position(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_TABPAGE:
+		{
+			int64_t data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_get_tabpage");
+				return;
+			} else {
+				emit on_window_get_tabpage(data);
+			}
+
+		}
+		break;
+	case NeovimApi::NEOVIM_FN_WINDOW_IS_VALID:
+		{
+			bool data;
+			if (decode(res, data)) {
+				m_c->setError(NeovimConnector::RuntimeMsgpackError, "Error unpacking return type for window_is_valid");
+				return;
+			} else {
+				emit on_window_is_valid(data);
+			}
+
+		}
+		break;
+	default:
+		qWarning() << "Received unexpected response";
+	}
+}
+
+/**
+ * 32bit FNV-1a hash, the seed selects one of a family of hashes. This
+ * must match function_hash() in generate_bindings.py
+ */
+static constexpr quint32 functionHash(quint32 h, const char *name, size_t size)
+{
+	return size == 0 ? h : functionHash((h ^ static_cast<quint8>(*name)) * 16777619u, name + 1, size - 1);
+}
+
+static constexpr quint32 functionHashSeed(qint32 seed)
+{
+	return 2166136261u ^ (static_cast<quint32>(seed) * 2654435769u);
+}
+
+struct FunctionTableEntry
+{
+	const char *name;
+	NeovimApi::FunctionId id;
+	/// Return and parameter types, @see Function::typeSignature
+	const char *signature;
+};
+
+/// Number of functions in the bindings
+static constexpr size_t c_functionCount{ 203 };
+
+/// Perfect hash seeds, indexed by the seed 0 hash of the function name
+static constexpr qint32 c_functionSeeds[c_functionCount] {
+	-197,
+	-189,
+	1,
+	0,
+	-188,
+	2,
+	1,
+	0,
+	-185,
+	0,
+	0,
+	-180,
+	-179,
+	-177,
+	-171,
+	3,
+	1,
+	1,
+	2,
+	-169,
+	0,
+	0,
+	0,
+	-164,
+	-156,
+	1,
+	0,
+	-155,
+	1,
+	0,
+	0,
+	0,
+	-152,
+	-149,
+	0,
+	0,
+	-148,
+	0,
+	0,
+	-146,
+	0,
+	0,
+	0,
+	0,
+	0,
+	-140,
+	1,
+	-139,
+	1,
+	0,
+	-138,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	-137,
+	3,
+	2,
+	-135,
+	2,
+	0,
+	-133,
+	-130,
+	-129,
+	2,
+	8,
+	0,
+	1,
+	-128,
+	1,
+	-126,
+	0,
+	-125,
+	0,
+	0,
+	0,
+	-121,
+	0,
+	1,
+	-120,
+	0,
+	2,
+	0,
+	-114,
+	-104,
+	0,
+	0,
+	-101,
+	-100,
+	0,
+	0,
+	0,
+	2,
+	-97,
+	-95,
+	-93,
+	-92,
+	-90,
+	6,
+	-88,
+	-87,
+	1,
+	0,
+	12,
+	6,
+	-85,
+	5,
+	0,
+	-83,
+	1,
+	1,
+	0,
+	-81,
+	0,
+	-80,
+	0,
+	1,
+	-77,
+	0,
+	-75,
+	0,
+	1,
+	0,
+	-74,
+	-66,
+	3,
+	2,
+	0,
+	-65,
+	-64,
+	2,
+	-62,
+	0,
+	0,
+	-60,
+	-55,
+	4,
+	0,
+	0,
+	4,
+	8,
+	1,
+	-53,
+	-51,
+	1,
+	7,
+	0,
+	-50,
+	-49,
+	-47,
+	-46,
+	-43,
+	0,
+	2,
+	-40,
+	8,
+	1,
+	1,
+	0,
+	0,
+	6,
+	-38,
+	1,
+	1,
+	-33,
+	0,
+	0,
+	0,
+	-32,
+	-29,
+	-26,
+	1,
+	-20,
+	0,
+	0,
+	0,
+	-19,
+	-17,
+	0,
+	1,
+	-13,
+	0,
+	1,
+	0,
+	0,
+	4,
+	-9,
+	-7,
+	0,
+	0,
+	10,
+	1,
+	-5,
+	0,
+	-4,
+	0,
+	5,
+	0,
+	0,
+	0,
+	1,
+};
+
+/// Perfect hash table of all functions, @see perfect_hash in generate_bindings.py
+static constexpr FunctionTableEntry c_functionTable[c_functionCount] {
+	{ "vim_list_runtime_paths", NeovimApi::NEOVIM_FN_VIM_LIST_RUNTIME_PATHS, "ArrayOf(String)()" },
+	{ "nvim_tabpage_get_win", NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_WIN, "Window(Tabpage)" },
+	{ "buffer_set_line_slice", NeovimApi::NEOVIM_FN_BUFFER_SET_LINE_SLICE, "void(Buffer, Integer, Integer, Boolean, Boolean, ArrayOf(String))" },
+	{ "tabpage_del_var", NeovimApi::NEOVIM_FN_TABPAGE_DEL_VAR, "Object(Tabpage, String)" },
+	{ "buffer_get_option", NeovimApi::NEOVIM_FN_BUFFER_GET_OPTION, "Object(Buffer, String)" },
+	{ "nvim_win_get_number", NeovimApi::NEOVIM_FN_NVIM_WIN_GET_NUMBER, "Integer(Window)" },
+	{ "nvim_list_wins", NeovimApi::NEOVIM_FN_NVIM_LIST_WINS, "ArrayOf(Window)()" },
+	{ "window_get_position", NeovimApi::NEOVIM_FN_WINDOW_GET_POSITION, "ArrayOf(Integer, 2)(Window)" },
+	{ "vim_get_color_map", NeovimApi::NEOVIM_FN_VIM_GET_COLOR_MAP, "Dictionary()" },
+	{ "nvim_buf_get_lines", NeovimApi::NEOVIM_FN_NVIM_BUF_GET_LINES, "ArrayOf(String)(Buffer, Integer, Integer, Boolean)" },
+	{ "nvim_buf_clear_highlight", NeovimApi::NEOVIM_FN_NVIM_BUF_CLEAR_HIGHLIGHT, "void(Buffer, Integer, Integer, Integer)" },
+	{ "vim_get_tabpages", NeovimApi::NEOVIM_FN_VIM_GET_TABPAGES, "ArrayOf(Tabpage)()" },
+	{ "buffer_get_line", NeovimApi::NEOVIM_FN_BUFFER_GET_LINE, "String(Buffer, Integer)" },
+	{ "vim_call_function", NeovimApi::NEOVIM_FN_VIM_CALL_FUNCTION, "Object(String, Array)" },
+	{ "nvim_win_set_var", NeovimApi::NEOVIM_FN_NVIM_WIN_SET_VAR, "void(Window, String, Object)" },
+	{ "vim_input", NeovimApi::NEOVIM_FN_VIM_INPUT, "Integer(String)" },
+	{ "nvim_ui_try_resize_grid", NeovimApi::NEOVIM_FN_NVIM_UI_TRY_RESIZE_GRID, "void(Integer, Integer, Integer)" },
+	{ "nvim_strwidth", NeovimApi::NEOVIM_FN_NVIM_STRWIDTH, "Integer(String)" },
+	{ "window_set_var", NeovimApi::NEOVIM_FN_WINDOW_SET_VAR, "Object(Window, String, Object)" },
+	{ "nvim_get_proc", NeovimApi::NEOVIM_FN_NVIM_GET_PROC, "Object(Integer)" },
+	{ "nvim_execute_lua", NeovimApi::NEOVIM_FN_NVIM_EXECUTE_LUA, "Object(String, Array)" },
+	{ "nvim_get_namespaces", NeovimApi::NEOVIM_FN_NVIM_GET_NAMESPACES, "Dictionary()" },
+	{ "window_get_var", NeovimApi::NEOVIM_FN_WINDOW_GET_VAR, "Object(Window, String)" },
+	{ "nvim_win_set_buf", NeovimApi::NEOVIM_FN_NVIM_WIN_SET_BUF, "void(Window, Buffer)" },
+	{ "nvim_ui_try_resize", NeovimApi::NEOVIM_FN_NVIM_UI_TRY_RESIZE, "void(Integer, Integer)" },
+	{ "nvim_get_proc_children", NeovimApi::NEOVIM_FN_NVIM_GET_PROC_CHILDREN, "Array(Integer)" },
+	{ "nvim_list_chans", NeovimApi::NEOVIM_FN_NVIM_LIST_CHANS, "Array()" },
+	{ "nvim_ui_set_option", NeovimApi::NEOVIM_FN_NVIM_UI_SET_OPTION, "void(String, Object)" },
+	{ "nvim_win_get_cursor", NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CURSOR, "ArrayOf(Integer, 2)(Window)" },
+	{ "nvim_set_current_line", NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_LINE, "void(String)" },
+	{ "nvim_list_bufs", NeovimApi::NEOVIM_FN_NVIM_LIST_BUFS, "ArrayOf(Buffer)()" },
+	{ "vim_subscribe", NeovimApi::NEOVIM_FN_VIM_SUBSCRIBE, "void(String)" },
+	{ "nvim_list_runtime_paths", NeovimApi::NEOVIM_FN_NVIM_LIST_RUNTIME_PATHS, "ArrayOf(String)()" },
+	{ "nvim_command", NeovimApi::NEOVIM_FN_NVIM_COMMAND, "void(String)" },
+	{ "nvim_buf_del_keymap", NeovimApi::NEOVIM_FN_NVIM_BUF_DEL_KEYMAP, "void(Buffer, String, String)" },
+	{ "nvim_win_get_buf", NeovimApi::NEOVIM_FN_NVIM_WIN_GET_BUF, "Buffer(Window)" },
+	{ "nvim_ui_attach", NeovimApi::NEOVIM_FN_NVIM_UI_ATTACH, "void(Integer, Integer, Dictionary)" },
+	{ "window_is_valid", NeovimApi::NEOVIM_FN_WINDOW_IS_VALID, "Boolean(Window)" },
+	{ "nvim_set_var", NeovimApi::NEOVIM_FN_NVIM_SET_VAR, "void(String, Object)" },
+	{ "nvim_replace_termcodes", NeovimApi::NEOVIM_FN_NVIM_REPLACE_TERMCODES, "String(String, Boolean, Boolean, Boolean)" },
+	{ "vim_set_current_window", NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_WINDOW, "void(Window)" },
+	{ "nvim_get_current_line", NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_LINE, "String()" },
+	{ "window_set_option", NeovimApi::NEOVIM_FN_WINDOW_SET_OPTION, "void(Window, String, Object)" },
+	{ "buffer_get_name", NeovimApi::NEOVIM_FN_BUFFER_GET_NAME, "String(Buffer)" },
+	{ "buffer_del_var", NeovimApi::NEOVIM_FN_BUFFER_DEL_VAR, "Object(Buffer, String)" },
+	{ "nvim_buf_detach", NeovimApi::NEOVIM_FN_NVIM_BUF_DETACH, "Boolean(Buffer)" },
+	{ "buffer_insert", NeovimApi::NEOVIM_FN_BUFFER_INSERT, "void(Buffer, Integer, ArrayOf(String))" },
+	{ "nvim_buf_clear_namespace", NeovimApi::NEOVIM_FN_NVIM_BUF_CLEAR_NAMESPACE, "void(Buffer, Integer, Integer, Integer)" },
+	{ "nvim_tabpage_set_var", NeovimApi::NEOVIM_FN_NVIM_TABPAGE_SET_VAR, "void(Tabpage, String, Object)" },
+	{ "tabpage_get_var", NeovimApi::NEOVIM_FN_TABPAGE_GET_VAR, "Object(Tabpage, String)" },
+	{ "nvim_list_tabpages", NeovimApi::NEOVIM_FN_NVIM_LIST_TABPAGES, "ArrayOf(Tabpage)()" },
+	{ "buffer_get_line_slice", NeovimApi::NEOVIM_FN_BUFFER_GET_LINE_SLICE, "ArrayOf(String)(Buffer, Integer, Integer, Boolean, Boolean)" },
+	{ "nvim_feedkeys", NeovimApi::NEOVIM_FN_NVIM_FEEDKEYS, "void(String, String, Boolean)" },
+	{ "window_get_buffer", NeovimApi::NEOVIM_FN_WINDOW_GET_BUFFER, "Buffer(Window)" },
+	{ "nvim_buf_add_highlight", NeovimApi::NEOVIM_FN_NVIM_BUF_ADD_HIGHLIGHT, "Integer(Buffer, Integer, String, Integer, Integer, Integer)" },
+	{ "buffer_set_var", NeovimApi::NEOVIM_FN_BUFFER_SET_VAR, "Object(Buffer, String, Object)" },
+	{ "nvim_win_close", NeovimApi::NEOVIM_FN_NVIM_WIN_CLOSE, "void(Window, Boolean)" },
+	{ "tabpage_get_windows", NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOWS, "ArrayOf(Window)(Tabpage)" },
+	{ "nvim_get_current_win", NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_WIN, "Window()" },
+	{ "nvim_err_write", NeovimApi::NEOVIM_FN_NVIM_ERR_WRITE, "void(String)" },
+	{ "vim_err_write", NeovimApi::NEOVIM_FN_VIM_ERR_WRITE, "void(String)" },
+	{ "nvim_win_get_config", NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CONFIG, "Dictionary(Window)" },
+	{ "buffer_del_line", NeovimApi::NEOVIM_FN_BUFFER_DEL_LINE, "void(Buffer, Integer)" },
+	{ "nvim_win_is_valid", NeovimApi::NEOVIM_FN_NVIM_WIN_IS_VALID, "Boolean(Window)" },
+	{ "nvim_call_atomic", NeovimApi::NEOVIM_FN_NVIM_CALL_ATOMIC, "Array(Array)" },
+	{ "nvim_tabpage_get_var", NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_VAR, "Object(Tabpage, String)" },
+	{ "vim_set_option", NeovimApi::NEOVIM_FN_VIM_SET_OPTION, "void(String, Object)" },
+	{ "nvim_win_del_var", NeovimApi::NEOVIM_FN_NVIM_WIN_DEL_VAR, "void(Window, String)" },
+	{ "nvim_get_current_tabpage", NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_TABPAGE, "Tabpage()" },
+	{ "ui_attach", NeovimApi::NEOVIM_FN_UI_ATTACH, "void(Integer, Integer, Boolean)" },
+	{ "nvim_del_current_line", NeovimApi::NEOVIM_FN_NVIM_DEL_CURRENT_LINE, "void()" },
+	{ "nvim_buf_is_valid", NeovimApi::NEOVIM_FN_NVIM_BUF_IS_VALID, "Boolean(Buffer)" },
+	{ "window_get_tabpage", NeovimApi::NEOVIM_FN_WINDOW_GET_TABPAGE, "Tabpage(Window)" },
+	{ "buffer_add_highlight", NeovimApi::NEOVIM_FN_BUFFER_ADD_HIGHLIGHT, "Integer(Buffer, Integer, String, Integer, Integer, Integer)" },
+	{ "nvim_get_context", NeovimApi::NEOVIM_FN_NVIM_GET_CONTEXT, "Dictionary(Dictionary)" },
+	{ "window_get_width", NeovimApi::NEOVIM_FN_WINDOW_GET_WIDTH, "Integer(Window)" },
+	{ "nvim_get_vvar", NeovimApi::NEOVIM_FN_NVIM_GET_VVAR, "Object(String)" },
+	{ "window_set_height", NeovimApi::NEOVIM_FN_WINDOW_SET_HEIGHT, "void(Window, Integer)" },
+	{ "nvim_del_keymap", NeovimApi::NEOVIM_FN_NVIM_DEL_KEYMAP, "void(String, String)" },
+	{ "buffer_is_valid", NeovimApi::NEOVIM_FN_BUFFER_IS_VALID, "Boolean(Buffer)" },
+	{ "nvim_del_var", NeovimApi::NEOVIM_FN_NVIM_DEL_VAR, "void(String)" },
+	{ "vim_get_option", NeovimApi::NEOVIM_FN_VIM_GET_OPTION, "Object(String)" },
+	{ "nvim_buf_get_keymap", NeovimApi::NEOVIM_FN_NVIM_BUF_GET_KEYMAP, "ArrayOf(Dictionary)(Buffer, String)" },
+	{ "nvim_input", NeovimApi::NEOVIM_FN_NVIM_INPUT, "Integer(String)" },
+	{ "nvim_buf_attach", NeovimApi::NEOVIM_FN_NVIM_BUF_ATTACH, "Boolean(Buffer, Boolean, Dictionary)" },
+	{ "nvim_buf_set_var", NeovimApi::NEOVIM_FN_NVIM_BUF_SET_VAR, "void(Buffer, String, Object)" },
+	{ "buffer_set_option", NeovimApi::NEOVIM_FN_BUFFER_SET_OPTION, "void(Buffer, String, Object)" },
+	{ "nvim_ui_detach", NeovimApi::NEOVIM_FN_NVIM_UI_DETACH, "void()" },
+	{ "nvim_unsubscribe", NeovimApi::NEOVIM_FN_NVIM_UNSUBSCRIBE, "void(String)" },
+	{ "nvim_win_set_height", NeovimApi::NEOVIM_FN_NVIM_WIN_SET_HEIGHT, "void(Window, Integer)" },
+	{ "nvim_buf_set_virtual_text", NeovimApi::NEOVIM_FN_NVIM_BUF_SET_VIRTUAL_TEXT, "Integer(Buffer, Integer, Integer, Array, Dictionary)" },
+	{ "nvim_call_dict_function", NeovimApi::NEOVIM_FN_NVIM_CALL_DICT_FUNCTION, "Object(Object, String, Array)" },
+	{ "nvim_win_get_height", NeovimApi::NEOVIM_FN_NVIM_WIN_GET_HEIGHT, "Integer(Window)" },
+	{ "vim_get_current_tabpage", NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_TABPAGE, "Tabpage()" },
+	{ "nvim_buf_get_changedtick", NeovimApi::NEOVIM_FN_NVIM_BUF_GET_CHANGEDTICK, "Integer(Buffer)" },
+	{ "nvim_set_client_info", NeovimApi::NEOVIM_FN_NVIM_SET_CLIENT_INFO, "void(String, Dictionary, String, Dictionary, Dictionary)" },
+	{ "nvim_out_write", NeovimApi::NEOVIM_FN_NVIM_OUT_WRITE, "void(String)" },
+	{ "buffer_get_lines", NeovimApi::NEOVIM_FN_BUFFER_GET_LINES, "ArrayOf(String)(Buffer, Integer, Integer, Boolean)" },
+	{ "vim_get_current_buffer", NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_BUFFER, "Buffer()" },
+	{ "nvim_put", NeovimApi::NEOVIM_FN_NVIM_PUT, "void(ArrayOf(String), String, Boolean, Boolean)" },
+	{ "window_set_width", NeovimApi::NEOVIM_FN_WINDOW_SET_WIDTH, "void(Window, Integer)" },
+	{ "vim_eval", NeovimApi::NEOVIM_FN_VIM_EVAL, "Object(String)" },
+	{ "nvim_win_set_option", NeovimApi::NEOVIM_FN_NVIM_WIN_SET_OPTION, "void(Window, String, Object)" },
+	{ "nvim_get_hl_by_id", NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_ID, "Dictionary(Integer, Boolean)" },
+	{ "nvim_paste", NeovimApi::NEOVIM_FN_NVIM_PASTE, "Boolean(String, Boolean, Integer)" },
+	{ "vim_name_to_color", NeovimApi::NEOVIM_FN_VIM_NAME_TO_COLOR, "Integer(String)" },
+	{ "nvim_set_current_buf", NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_BUF, "void(Buffer)" },
+	{ "vim_report_error", NeovimApi::NEOVIM_FN_VIM_REPORT_ERROR, "void(String)" },
+	{ "vim_out_write", NeovimApi::NEOVIM_FN_VIM_OUT_WRITE, "void(String)" },
+	{ "nvim_tabpage_del_var", NeovimApi::NEOVIM_FN_NVIM_TABPAGE_DEL_VAR, "void(Tabpage, String)" },
+	{ "nvim_buf_set_keymap", NeovimApi::NEOVIM_FN_NVIM_BUF_SET_KEYMAP, "void(Buffer, String, String, String, Dictionary)" },
+	{ "nvim_buf_del_var", NeovimApi::NEOVIM_FN_NVIM_BUF_DEL_VAR, "void(Buffer, String)" },
+	{ "nvim_buf_is_loaded", NeovimApi::NEOVIM_FN_NVIM_BUF_IS_LOADED, "Boolean(Buffer)" },
+	{ "nvim_buf_get_name", NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NAME, "String(Buffer)" },
+	{ "vim_set_var", NeovimApi::NEOVIM_FN_VIM_SET_VAR, "Object(String, Object)" },
+	{ "nvim_buf_set_lines", NeovimApi::NEOVIM_FN_NVIM_BUF_SET_LINES, "void(Buffer, Integer, Integer, Boolean, ArrayOf(String))" },
+	{ "nvim_get_api_info", NeovimApi::NEOVIM_FN_NVIM_GET_API_INFO, "Array()" },
+	{ "nvim_buf_get_option", NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OPTION, "Object(Buffer, String)" },
+	{ "nvim_win_set_cursor", NeovimApi::NEOVIM_FN_NVIM_WIN_SET_CURSOR, "void(Window, ArrayOf(Integer, 2))" },
+	{ "nvim_win_get_var", NeovimApi::NEOVIM_FN_NVIM_WIN_GET_VAR, "Object(Window, String)" },
+	{ "nvim_select_popupmenu_item", NeovimApi::NEOVIM_FN_NVIM_SELECT_POPUPMENU_ITEM, "void(Integer, Boolean, Boolean, Dictionary)" },
+	{ "vim_del_current_line", NeovimApi::NEOVIM_FN_VIM_DEL_CURRENT_LINE, "void()" },
+	{ "vim_set_current_tabpage", NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_TABPAGE, "void(Tabpage)" },
+	{ "vim_set_current_buffer", NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_BUFFER, "void(Buffer)" },
+	{ "vim_command", NeovimApi::NEOVIM_FN_VIM_COMMAND, "void(String)" },
+	{ "nvim_win_get_option", NeovimApi::NEOVIM_FN_NVIM_WIN_GET_OPTION, "Object(Window, String)" },
+	{ "nvim_win_set_width", NeovimApi::NEOVIM_FN_NVIM_WIN_SET_WIDTH, "void(Window, Integer)" },
+	{ "ui_try_resize", NeovimApi::NEOVIM_FN_UI_TRY_RESIZE, "Object(Integer, Integer)" },
+	{ "vim_get_current_line", NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_LINE, "String()" },
+	{ "nvim_set_vvar", NeovimApi::NEOVIM_FN_NVIM_SET_VVAR, "void(String, Object)" },
+	{ "nvim_get_color_map", NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_MAP, "Dictionary()" },
+	{ "nvim_buf_get_number", NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NUMBER, "Integer(Buffer)" },
+	{ "nvim_set_current_tabpage", NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_TABPAGE, "void(Tabpage)" },
+	{ "nvim_ui_pum_set_height", NeovimApi::NEOVIM_FN_NVIM_UI_PUM_SET_HEIGHT, "void(Integer)" },
+	{ "window_get_cursor", NeovimApi::NEOVIM_FN_WINDOW_GET_CURSOR, "ArrayOf(Integer, 2)(Window)" },
+	{ "vim_get_vvar", NeovimApi::NEOVIM_FN_VIM_GET_VVAR, "Object(String)" },
+	{ "nvim_get_color_by_name", NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_BY_NAME, "Integer(String)" },
+	{ "ui_detach", NeovimApi::NEOVIM_FN_UI_DETACH, "void()" },
+	{ "nvim_tabpage_list_wins", NeovimApi::NEOVIM_FN_NVIM_TABPAGE_LIST_WINS, "ArrayOf(Window)(Tabpage)" },
+	{ "nvim_win_get_position", NeovimApi::NEOVIM_FN_NVIM_WIN_GET_POSITION, "ArrayOf(Integer, 2)(Window)" },
+	{ "nvim_set_current_win", NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_WIN, "void(Window)" },
+	{ "nvim_buf_get_offset", NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OFFSET, "Integer(Buffer, Integer)" },
+	{ "vim_get_current_window", NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_WINDOW, "Window()" },
+	{ "vim_set_current_line", NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_LINE, "void(String)" },
+	{ "nvim_get_commands", NeovimApi::NEOVIM_FN_NVIM_GET_COMMANDS, "Dictionary(Dictionary)" },
+	{ "vim_feedkeys", NeovimApi::NEOVIM_FN_VIM_FEEDKEYS, "void(String, String, Boolean)" },
+	{ "buffer_line_count", NeovimApi::NEOVIM_FN_BUFFER_LINE_COUNT, "Integer(Buffer)" },
+	{ "buffer_get_var", NeovimApi::NEOVIM_FN_BUFFER_GET_VAR, "Object(Buffer, String)" },
+	{ "nvim_win_set_config", NeovimApi::NEOVIM_FN_NVIM_WIN_SET_CONFIG, "void(Window, Dictionary)" },
+	{ "nvim_set_keymap", NeovimApi::NEOVIM_FN_NVIM_SET_KEYMAP, "void(String, String, String, Dictionary)" },
+	{ "nvim_buf_get_var", NeovimApi::NEOVIM_FN_NVIM_BUF_GET_VAR, "Object(Buffer, String)" },
+	{ "vim_get_var", NeovimApi::NEOVIM_FN_VIM_GET_VAR, "Object(String)" },
+	{ "nvim_get_current_buf", NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_BUF, "Buffer()" },
+	{ "vim_get_windows", NeovimApi::NEOVIM_FN_VIM_GET_WINDOWS, "ArrayOf(Window)()" },
+	{ "nvim_tabpage_is_valid", NeovimApi::NEOVIM_FN_NVIM_TABPAGE_IS_VALID, "Boolean(Tabpage)" },
+	{ "nvim_list_uis", NeovimApi::NEOVIM_FN_NVIM_LIST_UIS, "Array()" },
+	{ "nvim_eval", NeovimApi::NEOVIM_FN_NVIM_EVAL, "Object(String)" },
+	{ "nvim_get_mode", NeovimApi::NEOVIM_FN_NVIM_GET_MODE, "Dictionary()" },
+	{ "nvim_buf_set_option", NeovimApi::NEOVIM_FN_NVIM_BUF_SET_OPTION, "void(Buffer, String, Object)" },
+	{ "nvim_win_get_width", NeovimApi::NEOVIM_FN_NVIM_WIN_GET_WIDTH, "Integer(Window)" },
+	{ "nvim_load_context", NeovimApi::NEOVIM_FN_NVIM_LOAD_CONTEXT, "Object(Dictionary)" },
+	{ "nvim_parse_expression", NeovimApi::NEOVIM_FN_NVIM_PARSE_EXPRESSION, "Dictionary(String, String, Boolean)" },
+	{ "window_get_option", NeovimApi::NEOVIM_FN_WINDOW_GET_OPTION, "Object(Window, String)" },
+	{ "nvim_create_buf", NeovimApi::NEOVIM_FN_NVIM_CREATE_BUF, "Buffer(Boolean, Boolean)" },
+	{ "vim_del_var", NeovimApi::NEOVIM_FN_VIM_DEL_VAR, "Object(String)" },
+	{ "nvim_input_mouse", NeovimApi::NEOVIM_FN_NVIM_INPUT_MOUSE, "void(String, String, String, Integer, Integer, Integer)" },
+	{ "nvim_create_namespace", NeovimApi::NEOVIM_FN_NVIM_CREATE_NAMESPACE, "Integer(String)" },
+	{ "nvim_win_get_tabpage", NeovimApi::NEOVIM_FN_NVIM_WIN_GET_TABPAGE, "Tabpage(Window)" },
+	{ "nvim_buf_get_commands", NeovimApi::NEOVIM_FN_NVIM_BUF_GET_COMMANDS, "Dictionary(Buffer, Dictionary)" },
+	{ "tabpage_is_valid", NeovimApi::NEOVIM_FN_TABPAGE_IS_VALID, "Boolean(Tabpage)" },
+	{ "vim_command_output", NeovimApi::NEOVIM_FN_VIM_COMMAND_OUTPUT, "String(String)" },
+	{ "tabpage_get_window", NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOW, "Window(Tabpage)" },
+	{ "nvim_subscribe", NeovimApi::NEOVIM_FN_NVIM_SUBSCRIBE, "void(String)" },
+	{ "vim_strwidth", NeovimApi::NEOVIM_FN_VIM_STRWIDTH, "Integer(String)" },
+	{ "buffer_set_line", NeovimApi::NEOVIM_FN_BUFFER_SET_LINE, "void(Buffer, Integer, String)" },
+	{ "nvim_open_win", NeovimApi::NEOVIM_FN_NVIM_OPEN_WIN, "Window(Buffer, Boolean, Dictionary)" },
+	{ "nvim_err_writeln", NeovimApi::NEOVIM_FN_NVIM_ERR_WRITELN, "void(String)" },
+	{ "nvim_get_keymap", NeovimApi::NEOVIM_FN_NVIM_GET_KEYMAP, "ArrayOf(Dictionary)(String)" },
+	{ "buffer_get_number", NeovimApi::NEOVIM_FN_BUFFER_GET_NUMBER, "Integer(Buffer)" },
+	{ "window_del_var", NeovimApi::NEOVIM_FN_WINDOW_DEL_VAR, "Object(Window, String)" },
+	{ "nvim_buf_set_name", NeovimApi::NEOVIM_FN_NVIM_BUF_SET_NAME, "void(Buffer, String)" },
+	{ "nvim_set_current_dir", NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_DIR, "void(String)" },
+	{ "nvim_get_hl_by_name", NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_NAME, "Dictionary(String, Boolean)" },
+	{ "nvim_buf_line_count", NeovimApi::NEOVIM_FN_NVIM_BUF_LINE_COUNT, "Integer(Buffer)" },
+	{ "vim_unsubscribe", NeovimApi::NEOVIM_FN_VIM_UNSUBSCRIBE, "void(String)" },
+	{ "nvim_get_option", NeovimApi::NEOVIM_FN_NVIM_GET_OPTION, "Object(String)" },
+	{ "buffer_clear_highlight", NeovimApi::NEOVIM_FN_BUFFER_CLEAR_HIGHLIGHT, "void(Buffer, Integer, Integer, Integer)" },
+	{ "nvim_call_function", NeovimApi::NEOVIM_FN_NVIM_CALL_FUNCTION, "Object(String, Array)" },
+	{ "tabpage_set_var", NeovimApi::NEOVIM_FN_TABPAGE_SET_VAR, "Object(Tabpage, String, Object)" },
+	{ "window_set_cursor", NeovimApi::NEOVIM_FN_WINDOW_SET_CURSOR, "void(Window, ArrayOf(Integer, 2))" },
+	{ "nvim_tabpage_get_number", NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_NUMBER, "Integer(Tabpage)" },
+	{ "vim_change_directory", NeovimApi::NEOVIM_FN_VIM_CHANGE_DIRECTORY, "void(String)" },
+	{ "nvim_get_var", NeovimApi::NEOVIM_FN_NVIM_GET_VAR, "Object(String)" },
+	{ "buffer_get_mark", NeovimApi::NEOVIM_FN_BUFFER_GET_MARK, "ArrayOf(Integer, 2)(Buffer, String)" },
+	{ "buffer_set_name", NeovimApi::NEOVIM_FN_BUFFER_SET_NAME, "void(Buffer, String)" },
+	{ "nvim_set_option", NeovimApi::NEOVIM_FN_NVIM_SET_OPTION, "void(String, Object)" },
+	{ "nvim_get_chan_info", NeovimApi::NEOVIM_FN_NVIM_GET_CHAN_INFO, "Dictionary(Integer)" },
+	{ "nvim_command_output", NeovimApi::NEOVIM_FN_NVIM_COMMAND_OUTPUT, "String(String)" },
+	{ "vim_get_buffers", NeovimApi::NEOVIM_FN_VIM_GET_BUFFERS, "ArrayOf(Buffer)()" },
+	{ "nvim_buf_get_mark", NeovimApi::NEOVIM_FN_NVIM_BUF_GET_MARK, "ArrayOf(Integer, 2)(Buffer, String)" },
+	{ "vim_replace_termcodes", NeovimApi::NEOVIM_FN_VIM_REPLACE_TERMCODES, "String(String, Boolean, Boolean, Boolean)" },
+	{ "window_get_height", NeovimApi::NEOVIM_FN_WINDOW_GET_HEIGHT, "Integer(Window)" },
+	{ "buffer_set_lines", NeovimApi::NEOVIM_FN_BUFFER_SET_LINES, "void(Buffer, Integer, Integer, Boolean, ArrayOf(String))" },
+};
+
+static const FunctionTableEntry* findFunction(const QByteArray& name)
+{
+	const qint32 seed{ c_functionSeeds[functionHash(functionHashSeed(0), name.constData(), name.size()) % c_functionCount] };
+	const size_t slot{ seed < 0
+		? static_cast<size_t>(-seed - 1)
+		: functionHash(functionHashSeed(seed), name.constData(), name.size()) % c_functionCount };
+
+	const FunctionTableEntry& entry{ c_functionTable[slot] };
+	return name == entry.name ? &entry : nullptr;
+}
+
+/**
+ * Find a function by name, returns NEOVIM_FN_NULL for unknown functions
+ */
+NeovimApi::FunctionId NeovimApi::functionId(const QByteArray& name)
+{
+	const FunctionTableEntry *entry{ findFunction(name) };
+	return entry ? entry->id : NEOVIM_FN_NULL;
+}
+
+/**
+ * Find a function with the same name, return and parameter types as f,
+ * returns NEOVIM_FN_NULL if the bindings have no such function
+ */
+NeovimApi::FunctionId NeovimApi::functionId(const Function& f)
+{
+	const FunctionTableEntry *entry{ findFunction(f.name.toUtf8()) };
+	if (!entry || f.typeSignature() != QLatin1String(entry->signature)) {
+		return NEOVIM_FN_NULL;
+	}
+	return entry->id;
+}
+
+/**
+ * The API level in which a function was introduced
+ */
+quint64 NeovimApi::functionApiLevel(FunctionId f)
+{
+	switch(f) {
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_LINE:
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_LINE:
+	case NeovimApi::NEOVIM_FN_BUFFER_DEL_LINE:
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_LINE_SLICE:
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_LINE_SLICE:
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_VAR:
+	case NeovimApi::NEOVIM_FN_BUFFER_DEL_VAR:
+	case NeovimApi::NEOVIM_FN_BUFFER_INSERT:
+	case NeovimApi::NEOVIM_FN_TABPAGE_SET_VAR:
+	case NeovimApi::NEOVIM_FN_TABPAGE_DEL_VAR:
+	case NeovimApi::NEOVIM_FN_UI_ATTACH:
+	case NeovimApi::NEOVIM_FN_VIM_SET_VAR:
+	case NeovimApi::NEOVIM_FN_VIM_DEL_VAR:
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_VAR:
+	case NeovimApi::NEOVIM_FN_WINDOW_DEL_VAR:
+	case NeovimApi::NEOVIM_FN_BUFFER_LINE_COUNT:
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_LINES:
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_LINES:
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_VAR:
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_OPTION:
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_OPTION:
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_NUMBER:
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_NAME:
+	case NeovimApi::NEOVIM_FN_BUFFER_SET_NAME:
+	case NeovimApi::NEOVIM_FN_BUFFER_IS_VALID:
+	case NeovimApi::NEOVIM_FN_BUFFER_GET_MARK:
+	case NeovimApi::NEOVIM_FN_BUFFER_ADD_HIGHLIGHT:
+	case NeovimApi::NEOVIM_FN_BUFFER_CLEAR_HIGHLIGHT:
+	case NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOWS:
+	case NeovimApi::NEOVIM_FN_TABPAGE_GET_VAR:
+	case NeovimApi::NEOVIM_FN_TABPAGE_GET_WINDOW:
+	case NeovimApi::NEOVIM_FN_TABPAGE_IS_VALID:
+	case NeovimApi::NEOVIM_FN_UI_DETACH:
+	case NeovimApi::NEOVIM_FN_UI_TRY_RESIZE:
+	case NeovimApi::NEOVIM_FN_VIM_COMMAND:
+	case NeovimApi::NEOVIM_FN_VIM_FEEDKEYS:
+	case NeovimApi::NEOVIM_FN_VIM_INPUT:
+	case NeovimApi::NEOVIM_FN_VIM_REPLACE_TERMCODES:
+	case NeovimApi::NEOVIM_FN_VIM_COMMAND_OUTPUT:
+	case NeovimApi::NEOVIM_FN_VIM_EVAL:
+	case NeovimApi::NEOVIM_FN_VIM_CALL_FUNCTION:
+	case NeovimApi::NEOVIM_FN_VIM_STRWIDTH:
+	case NeovimApi::NEOVIM_FN_VIM_LIST_RUNTIME_PATHS:
+	case NeovimApi::NEOVIM_FN_VIM_CHANGE_DIRECTORY:
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_LINE:
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_LINE:
+	case NeovimApi::NEOVIM_FN_VIM_DEL_CURRENT_LINE:
+	case NeovimApi::NEOVIM_FN_VIM_GET_VAR:
+	case NeovimApi::NEOVIM_FN_VIM_GET_VVAR:
+	case NeovimApi::NEOVIM_FN_VIM_GET_OPTION:
+	case NeovimApi::NEOVIM_FN_VIM_SET_OPTION:
+	case NeovimApi::NEOVIM_FN_VIM_OUT_WRITE:
+	case NeovimApi::NEOVIM_FN_VIM_ERR_WRITE:
+	case NeovimApi::NEOVIM_FN_VIM_REPORT_ERROR:
+	case NeovimApi::NEOVIM_FN_VIM_GET_BUFFERS:
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_BUFFER:
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_BUFFER:
+	case NeovimApi::NEOVIM_FN_VIM_GET_WINDOWS:
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_WINDOW:
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_WINDOW:
+	case NeovimApi::NEOVIM_FN_VIM_GET_TABPAGES:
+	case NeovimApi::NEOVIM_FN_VIM_GET_CURRENT_TABPAGE:
+	case NeovimApi::NEOVIM_FN_VIM_SET_CURRENT_TABPAGE:
+	case NeovimApi::NEOVIM_FN_VIM_SUBSCRIBE:
+	case NeovimApi::NEOVIM_FN_VIM_UNSUBSCRIBE:
+	case NeovimApi::NEOVIM_FN_VIM_NAME_TO_COLOR:
+	case NeovimApi::NEOVIM_FN_VIM_GET_COLOR_MAP:
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_BUFFER:
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_CURSOR:
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_CURSOR:
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_HEIGHT:
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_HEIGHT:
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_WIDTH:
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_WIDTH:
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_VAR:
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_OPTION:
+	case NeovimApi::NEOVIM_FN_WINDOW_SET_OPTION:
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_POSITION:
+	case NeovimApi::NEOVIM_FN_WINDOW_GET_TABPAGE:
+	case NeovimApi::NEOVIM_FN_WINDOW_IS_VALID:
+		return 0;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_LINE_COUNT:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_LINES:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_LINES:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_DEL_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OPTION:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_OPTION:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NUMBER:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_NAME:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_NAME:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_IS_VALID:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_MARK:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_ADD_HIGHLIGHT:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_CLEAR_HIGHLIGHT:
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_LIST_WINS:
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_SET_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_DEL_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_WIN:
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_GET_NUMBER:
+	case NeovimApi::NEOVIM_FN_NVIM_TABPAGE_IS_VALID:
+	case NeovimApi::NEOVIM_FN_NVIM_UI_ATTACH:
+	case NeovimApi::NEOVIM_FN_NVIM_UI_DETACH:
+	case NeovimApi::NEOVIM_FN_NVIM_UI_TRY_RESIZE:
+	case NeovimApi::NEOVIM_FN_NVIM_UI_SET_OPTION:
+	case NeovimApi::NEOVIM_FN_NVIM_COMMAND:
+	case NeovimApi::NEOVIM_FN_NVIM_FEEDKEYS:
+	case NeovimApi::NEOVIM_FN_NVIM_INPUT:
+	case NeovimApi::NEOVIM_FN_NVIM_REPLACE_TERMCODES:
+	case NeovimApi::NEOVIM_FN_NVIM_COMMAND_OUTPUT:
+	case NeovimApi::NEOVIM_FN_NVIM_EVAL:
+	case NeovimApi::NEOVIM_FN_NVIM_CALL_FUNCTION:
+	case NeovimApi::NEOVIM_FN_NVIM_STRWIDTH:
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_RUNTIME_PATHS:
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_DIR:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_LINE:
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_LINE:
+	case NeovimApi::NEOVIM_FN_NVIM_DEL_CURRENT_LINE:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_SET_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_DEL_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_VVAR:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_OPTION:
+	case NeovimApi::NEOVIM_FN_NVIM_SET_OPTION:
+	case NeovimApi::NEOVIM_FN_NVIM_OUT_WRITE:
+	case NeovimApi::NEOVIM_FN_NVIM_ERR_WRITE:
+	case NeovimApi::NEOVIM_FN_NVIM_ERR_WRITELN:
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_BUFS:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_BUF:
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_BUF:
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_WINS:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_WIN:
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_WIN:
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_TABPAGES:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CURRENT_TABPAGE:
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CURRENT_TABPAGE:
+	case NeovimApi::NEOVIM_FN_NVIM_SUBSCRIBE:
+	case NeovimApi::NEOVIM_FN_NVIM_UNSUBSCRIBE:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_BY_NAME:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_COLOR_MAP:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_API_INFO:
+	case NeovimApi::NEOVIM_FN_NVIM_CALL_ATOMIC:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_BUF:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CURSOR:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_CURSOR:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_HEIGHT:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_HEIGHT:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_WIDTH:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_WIDTH:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_DEL_VAR:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_OPTION:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_OPTION:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_POSITION:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_TABPAGE:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_NUMBER:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_IS_VALID:
+		return 1;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_CHANGEDTICK:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_MODE:
+		return 2;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_KEYMAP:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_NAME:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_HL_BY_ID:
+	case NeovimApi::NEOVIM_FN_NVIM_EXECUTE_LUA:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_KEYMAP:
+		return 3;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_ATTACH:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_DETACH:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_COMMANDS:
+	case NeovimApi::NEOVIM_FN_NVIM_CALL_DICT_FUNCTION:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_COMMANDS:
+	case NeovimApi::NEOVIM_FN_NVIM_SET_CLIENT_INFO:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CHAN_INFO:
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_CHANS:
+	case NeovimApi::NEOVIM_FN_NVIM_PARSE_EXPRESSION:
+	case NeovimApi::NEOVIM_FN_NVIM_LIST_UIS:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_PROC_CHILDREN:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_PROC:
+		return 4;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_GET_OFFSET:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_IS_LOADED:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_CLEAR_NAMESPACE:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_VIRTUAL_TEXT:
+	case NeovimApi::NEOVIM_FN_NVIM_CREATE_NAMESPACE:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_NAMESPACES:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_BUF:
+		return 5;
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_SET_KEYMAP:
+	case NeovimApi::NEOVIM_FN_NVIM_BUF_DEL_KEYMAP:
+	case NeovimApi::NEOVIM_FN_NVIM_UI_TRY_RESIZE_GRID:
+	case NeovimApi::NEOVIM_FN_NVIM_UI_PUM_SET_HEIGHT:
+	case NeovimApi::NEOVIM_FN_NVIM_INPUT_MOUSE:
+	case NeovimApi::NEOVIM_FN_NVIM_SET_VVAR:
+	case NeovimApi::NEOVIM_FN_NVIM_CREATE_BUF:
+	case NeovimApi::NEOVIM_FN_NVIM_OPEN_WIN:
+	case NeovimApi::NEOVIM_FN_NVIM_PASTE:
+	case NeovimApi::NEOVIM_FN_NVIM_PUT:
+	case NeovimApi::NEOVIM_FN_NVIM_GET_CONTEXT:
+	case NeovimApi::NEOVIM_FN_NVIM_LOAD_CONTEXT:
+	case NeovimApi::NEOVIM_FN_NVIM_SET_KEYMAP:
+	case NeovimApi::NEOVIM_FN_NVIM_DEL_KEYMAP:
+	case NeovimApi::NEOVIM_FN_NVIM_SELECT_POPUPMENU_ITEM:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_SET_CONFIG:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_GET_CONFIG:
+	case NeovimApi::NEOVIM_FN_NVIM_WIN_CLOSE:
+		return 6;
+	default:
+		return 0;
+	}
+}
+
+/**
+ * True if the function is available at the API level negotiated with Neovim
+ */
+bool NeovimApi::hasFunction(FunctionId f) const
+{
+	return f != NEOVIM_FN_NULL && functionApiLevel(f) <= m_c->apiLevel();
+}
+
+/**
+ * Check function table from api_metadata[1]
+ *
+ * This checks the API metadata build from the bindings, for functions up to
+ * the given API level, against the metadata passed as argument.
+ *
+ * Returns false if there is an API mismatch
+ */
+bool NeovimApi::checkFunctions(const QVariantList& ftable, quint64 apiLevel)
+{
+	// Indexed by FunctionId
+	std::vector<bool> supported(c_functionCount + 1, false);
+	foreach(const QVariant& val, ftable) {
+		auto f = Function::fromVariant(val);
+		if (!f.isValid()) {
+			qDebug() << "Invalid function in metadata" << f;
+			continue;
+		}
+
+		const FunctionId id{ functionId(f) };
+		if (id == NEOVIM_FN_NULL) {
+			qDebug() << "Unknown function(api" << apiLevel << ")" << f;
+			continue;
+		}
+		supported[id] = true;
+	}
+
+	bool ok = true;
+	for (const FunctionTableEntry& entry : c_functionTable) {
+		if (functionApiLevel(entry.id) <= apiLevel && !supported[entry.id]) {
+			qDebug() << "- instance DOES NOT support API" << apiLevel << ":" << entry.name << entry.signature;
+			ok = false;
+		}
+	}
+	return ok;
+}
+
+} // Namespace
\ No newline at end of file
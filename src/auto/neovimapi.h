@@ -1,6 +1,7 @@
-// Auto generated 2021-07-21 04:43:51.959832 from nvim API level:6
+// Auto generated 2026-10-18 01:42:26.849460 from nvim API level:6
 #pragma once
 
+#include <functional>
 #include <QObject>
 #include <QPoint>
 #include <QVariant>
@@ -13,7 +14,13 @@ namespace NeovimQt {
 class NeovimConnector;
 class MsgpackRequest;
 
-class NeovimApi6: public QObject
+/**
+ * Bindings for all Neovim API functions up to API level 6
+ *
+ * A single instance serves every API level, NeovimConnector hands it out
+ * for the levels supported by the Neovim instance.
+ */
+class NeovimApi: public QObject
 {
 	Q_OBJECT
 
@@ -227,10 +234,13 @@ public:
 			};
 	Q_ENUM(FunctionId)
 
-	static bool checkFunctions(const QVariantList& ftable);
+	static bool checkFunctions(const QVariantList& ftable, quint64 apiLevel);
 	static FunctionId functionId(const Function& f);
+	static FunctionId functionId(const QByteArray& name);
+	static quint64 functionApiLevel(FunctionId f);
 
-	NeovimApi6(NeovimConnector *);
+	NeovimApi(NeovimConnector *);
+	bool hasFunction(FunctionId f) const;
 protected slots:
 	void handleResponse(quint32 id, quint64 fun, const QVariant&);
 	void handleResponseError(quint32 id, quint64 fun, const QVariant&);
@@ -728,6 +738,135 @@ public slots:
 	// Boolean window_is_valid(Window window, ) 
 	NeovimQt::MsgpackRequest* window_is_valid(int64_t window);
 
+public:
+	// Typed callbacks, the result is decoded directly from msgpack
+	NeovimQt::MsgpackRequest* nvim_buf_line_count(int64_t buffer, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* buffer_get_line(int64_t buffer, int64_t index, std::function<void(QByteArray)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_attach(int64_t buffer, bool send_buffer, QVariantMap opts, std::function<void(bool)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_detach(int64_t buffer, std::function<void(bool)> callback);
+	NeovimQt::MsgpackRequest* buffer_get_line_slice(int64_t buffer, int64_t start, int64_t end, bool include_start, bool include_end, std::function<void(QList<QByteArray>)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_get_lines(int64_t buffer, int64_t start, int64_t end, bool strict_indexing, std::function<void(QList<QByteArray>)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_get_offset(int64_t buffer, int64_t index, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_get_var(int64_t buffer, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_get_changedtick(int64_t buffer, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_get_keymap(int64_t buffer, QByteArray mode, std::function<void(QList<QVariantMap>)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_get_commands(int64_t buffer, QVariantMap opts, std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* buffer_set_var(int64_t buffer, QByteArray name, QVariant value, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* buffer_del_var(int64_t buffer, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_get_option(int64_t buffer, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_get_number(int64_t buffer, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_get_name(int64_t buffer, std::function<void(QByteArray)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_is_loaded(int64_t buffer, std::function<void(bool)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_is_valid(int64_t buffer, std::function<void(bool)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_get_mark(int64_t buffer, QByteArray name, std::function<void(QPoint)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_add_highlight(int64_t buffer, int64_t ns_id, QByteArray hl_group, int64_t line, int64_t col_start, int64_t col_end, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_buf_set_virtual_text(int64_t buffer, int64_t ns_id, int64_t line, QVariantList chunks, QVariantMap opts, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_tabpage_list_wins(int64_t tabpage, std::function<void(QList<int64_t>)> callback);
+	NeovimQt::MsgpackRequest* nvim_tabpage_get_var(int64_t tabpage, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* tabpage_set_var(int64_t tabpage, QByteArray name, QVariant value, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* tabpage_del_var(int64_t tabpage, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_tabpage_get_win(int64_t tabpage, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_tabpage_get_number(int64_t tabpage, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_tabpage_is_valid(int64_t tabpage, std::function<void(bool)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_hl_by_name(QByteArray name, bool rgb, std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_hl_by_id(int64_t hl_id, bool rgb, std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* nvim_input(QByteArray keys, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_replace_termcodes(QByteArray str, bool from_part, bool do_lt, bool special, std::function<void(QByteArray)> callback);
+	NeovimQt::MsgpackRequest* nvim_command_output(QByteArray command, std::function<void(QByteArray)> callback);
+	NeovimQt::MsgpackRequest* nvim_eval(QByteArray expr, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_execute_lua(QByteArray code, QVariantList args, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_call_function(QByteArray fn, QVariantList args, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_call_dict_function(QVariant dict, QByteArray fn, QVariantList args, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_strwidth(QByteArray text, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_list_runtime_paths(std::function<void(QList<QByteArray>)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_current_line(std::function<void(QByteArray)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_var(QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* vim_set_var(QByteArray name, QVariant value, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* vim_del_var(QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_vvar(QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_option(QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_list_bufs(std::function<void(QList<int64_t>)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_current_buf(std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_list_wins(std::function<void(QList<int64_t>)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_current_win(std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_create_buf(bool listed, bool scratch, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_open_win(int64_t buffer, bool enter, QVariantMap config, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_list_tabpages(std::function<void(QList<int64_t>)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_current_tabpage(std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_create_namespace(QByteArray name, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_namespaces(std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* nvim_paste(QByteArray data, bool crlf, int64_t phase, std::function<void(bool)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_color_by_name(QByteArray name, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_color_map(std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_context(QVariantMap opts, std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* nvim_load_context(QVariantMap dict, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_mode(std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_keymap(QByteArray mode, std::function<void(QList<QVariantMap>)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_commands(QVariantMap opts, std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_api_info(std::function<void(QVariantList)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_chan_info(int64_t chan, std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* nvim_list_chans(std::function<void(QVariantList)> callback);
+	NeovimQt::MsgpackRequest* nvim_call_atomic(QVariantList calls, std::function<void(QVariantList)> callback);
+	NeovimQt::MsgpackRequest* nvim_parse_expression(QByteArray expr, QByteArray flags, bool highlight, std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* nvim_list_uis(std::function<void(QVariantList)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_proc_children(int64_t pid, std::function<void(QVariantList)> callback);
+	NeovimQt::MsgpackRequest* nvim_get_proc(int64_t pid, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_win_get_buf(int64_t window, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_win_get_cursor(int64_t window, std::function<void(QPoint)> callback);
+	NeovimQt::MsgpackRequest* nvim_win_get_height(int64_t window, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_win_get_width(int64_t window, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_win_get_var(int64_t window, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* window_set_var(int64_t window, QByteArray name, QVariant value, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* window_del_var(int64_t window, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_win_get_option(int64_t window, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* nvim_win_get_position(int64_t window, std::function<void(QPoint)> callback);
+	NeovimQt::MsgpackRequest* nvim_win_get_tabpage(int64_t window, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_win_get_number(int64_t window, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* nvim_win_is_valid(int64_t window, std::function<void(bool)> callback);
+	NeovimQt::MsgpackRequest* nvim_win_get_config(int64_t window, std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* buffer_line_count(int64_t buffer, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* buffer_get_lines(int64_t buffer, int64_t start, int64_t end, bool strict_indexing, std::function<void(QList<QByteArray>)> callback);
+	NeovimQt::MsgpackRequest* buffer_get_var(int64_t buffer, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* buffer_get_option(int64_t buffer, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* buffer_get_number(int64_t buffer, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* buffer_get_name(int64_t buffer, std::function<void(QByteArray)> callback);
+	NeovimQt::MsgpackRequest* buffer_is_valid(int64_t buffer, std::function<void(bool)> callback);
+	NeovimQt::MsgpackRequest* buffer_get_mark(int64_t buffer, QByteArray name, std::function<void(QPoint)> callback);
+	NeovimQt::MsgpackRequest* buffer_add_highlight(int64_t buffer, int64_t ns_id, QByteArray hl_group, int64_t line, int64_t col_start, int64_t col_end, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* tabpage_get_windows(int64_t tabpage, std::function<void(QList<int64_t>)> callback);
+	NeovimQt::MsgpackRequest* tabpage_get_var(int64_t tabpage, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* tabpage_get_window(int64_t tabpage, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* tabpage_is_valid(int64_t tabpage, std::function<void(bool)> callback);
+	NeovimQt::MsgpackRequest* ui_try_resize(int64_t width, int64_t height, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* vim_input(QByteArray keys, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* vim_replace_termcodes(QByteArray str, bool from_part, bool do_lt, bool special, std::function<void(QByteArray)> callback);
+	NeovimQt::MsgpackRequest* vim_command_output(QByteArray command, std::function<void(QByteArray)> callback);
+	NeovimQt::MsgpackRequest* vim_eval(QByteArray expr, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* vim_call_function(QByteArray fn, QVariantList args, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* vim_strwidth(QByteArray text, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* vim_list_runtime_paths(std::function<void(QList<QByteArray>)> callback);
+	NeovimQt::MsgpackRequest* vim_get_current_line(std::function<void(QByteArray)> callback);
+	NeovimQt::MsgpackRequest* vim_get_var(QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* vim_get_vvar(QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* vim_get_option(QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* vim_get_buffers(std::function<void(QList<int64_t>)> callback);
+	NeovimQt::MsgpackRequest* vim_get_current_buffer(std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* vim_get_windows(std::function<void(QList<int64_t>)> callback);
+	NeovimQt::MsgpackRequest* vim_get_current_window(std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* vim_get_tabpages(std::function<void(QList<int64_t>)> callback);
+	NeovimQt::MsgpackRequest* vim_get_current_tabpage(std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* vim_name_to_color(QByteArray name, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* vim_get_color_map(std::function<void(QVariantMap)> callback);
+	NeovimQt::MsgpackRequest* window_get_buffer(int64_t window, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* window_get_cursor(int64_t window, std::function<void(QPoint)> callback);
+	NeovimQt::MsgpackRequest* window_get_height(int64_t window, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* window_get_width(int64_t window, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* window_get_var(int64_t window, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* window_get_option(int64_t window, QByteArray name, std::function<void(QVariant)> callback);
+	NeovimQt::MsgpackRequest* window_get_position(int64_t window, std::function<void(QPoint)> callback);
+	NeovimQt::MsgpackRequest* window_get_tabpage(int64_t window, std::function<void(int64_t)> callback);
+	NeovimQt::MsgpackRequest* window_is_valid(int64_t window, std::function<void(bool)> callback);
+
 signals:
 	void on_nvim_buf_line_count(int64_t);
 	void err_nvim_buf_line_count(const QString&, const QVariant&);
@@ -1340,4 +1479,12 @@ signals:
 
 };
 
+typedef NeovimApi NeovimApi0;
+typedef NeovimApi NeovimApi1;
+typedef NeovimApi NeovimApi2;
+typedef NeovimApi NeovimApi3;
+typedef NeovimApi NeovimApi4;
+typedef NeovimApi NeovimApi5;
+typedef NeovimApi NeovimApi6;
+
 } // namespace NeovimQt
\ No newline at end of file
@@ -183,5 +183,20 @@ QString Function::signature() const
 	return  QString("%1 %2(%3)%4").arg(return_type, name, sigparams.join(", "), notes);
 }
 
+/**
+ * The return and parameter types of this function, e.g. Integer(Buffer, String)
+ *
+ * Two functions with the same name and type signature are identical,
+ * @see operator==
+ */
+QString Function::typeSignature() const
+{
+	QStringList types;
+	foreach(const StringPair p, parameters) {
+		types.append(p.first);
+	}
+	return QString("%1(%2)").arg(return_type, types.join(", "));
+}
+
 } // Namespace
 
@@ -32,11 +32,7 @@ public:
 	QList<QPair<QString,QString> > parameters;
 
 	QString signature() const;
-	/**
-	 * The static list **knowFunctions** holds a list of all the supported
-	 * signature. The list is populated at compile time from a code generator.
-	 */
-	const static QList<Function> knownFunctions;
+	QString typeSignature() const;
 private:
 	bool m_valid;
 };
@@ -38,6 +38,7 @@ struct ConnectorInitArgs
 	const QString nvim;
 	const QStringList positionalArgs;
 	const QStringList neovimArgs;
+	const bool parserThread{ false };
 
 	ConnectorInitArgs(const QCommandLineParser& parser, QStringList nvimArgs) noexcept;
 
@@ -70,6 +71,7 @@ ConnectorInitArgs::ConnectorInitArgs(
 	, nvim{ parser.value("nvim") }
 	, positionalArgs{ parser.positionalArguments() }
 	, neovimArgs{ std::move(nvimArgs) }
+	, parserThread{ parser.isSet("rpc-thread") }
 {
 }
 
@@ -113,6 +115,9 @@ NeovimConnector& connectToRemoteNeovim(const ConnectorInitArgs& args) noexcept
 	}
 
 	connector->setRequestTimeout(args.timeout);
+	if (args.parserThread) {
+		connector->startParserThread();
+	}
 	return *connector;
 }
 
@@ -205,6 +210,9 @@ App::App(int &argc, char ** argv) noexcept
 	setOrganizationName("nvim-qt");
 	setApplicationName("nvim-qt");
 
+	// Skip waiting for the API metadata when spawning a known nvim binary
+	NeovimConnector::setMetadataCacheEnabled(true);
+
 #ifdef Q_OS_MAC
 	QByteArray shellPath = qgetenv("SHELL");
 	if (!getLoginEnvironment(shellPath)) {
@@ -335,6 +343,8 @@ void App::processCommandlineOptions(QCommandLineParser& parser, QStringList argu
 				QCoreApplication::translate("main", "addr")));
 	parser.addOption(QCommandLineOption("spawn",
 				QCoreApplication::translate("main", "Treat positional arguments as the nvim argv")));
+	parser.addOption(QCommandLineOption("rpc-thread",
+				QCoreApplication::translate("main", "Parse messages from Neovim in a background thread")));
 	parser.addOption(QCommandLineOption({ "v", "version" },
 				QCoreApplication::translate("main", "Displays version information.")));
 
@@ -24,12 +24,19 @@
 
 namespace NeovimQt {
 
+/// Stacking order of multigrid windows, floats use c_floatZIndex unless
+/// Neovim sends a zindex.
+constexpr int c_windowZIndex{ 0 };
+constexpr int c_floatZIndex{ 50 };
+constexpr int c_messageZIndex{ 200 };
+
 static ShellOptions GetShellOptionsFromQSettings() noexcept
 {
 	ShellOptions opts;
 	QSettings settings;
 
 	QVariant ext_linegrid{ settings.value("ext_linegrid", opts.IsLineGridEnabled()) };
+	QVariant ext_multigrid{ settings.value("ext_multigrid", opts.IsMultigridEnabled()) };
 	QVariant ext_popupmenu{ settings.value("ext_popupmenu", opts.IsPopupmenuEnabled()) };
 	QVariant ext_tabline{ settings.value("ext_tabline", opts.IsTablineEnabled()) };
 
@@ -38,6 +45,11 @@ static ShellOptions GetShellOptionsFromQSettings() noexcept
 		opts.SetIsLineGridEnabled(ext_linegrid.toBool());
 	}
 
+	if (ext_multigrid.canConvert<bool>())
+	{
+		opts.SetIsMultigridEnabled(ext_multigrid.toBool());
+	}
+
 	if (ext_popupmenu.canConvert<bool>())
 	{
 		opts.SetIsPopupmenuEnabled(ext_popupmenu.toBool());
@@ -60,6 +72,10 @@ Shell::Shell(NeovimConnector *nvim, QWidget *parent)
 
 	setAcceptDrops(true);
 	setMouseTracking(true);
+
+	// Repaint once per redraw batch, see handleFlush
+	setFrameBatchingEnabled(true);
+
 	m_mouseclick_timer.setInterval(QApplication::doubleClickInterval());
 	m_mouseclick_timer.setSingleShot(true);
 	connect(&m_mouseclick_timer, &QTimer::timeout,
@@ -191,7 +207,7 @@ bool Shell::setGuiFontWide(const QString& fdesc) noexcept
 	// An empty list is valid, use guifont
 	if (fdesc.isEmpty())
 	{
-		m_guifontwidelist = {};
+		setGuiFontList({});
 		update();
 		return true;
 	}
@@ -216,7 +232,7 @@ bool Shell::setGuiFontWide(const QString& fdesc) noexcept
 		fontList.push_back(qvariant_cast<QFont>(varFont));
 	}
 
-	m_guifontwidelist = std::move(fontList);
+	setGuiFontList(std::move(fontList));
 	update();
 	return true;
 }
@@ -268,6 +284,10 @@ void Shell::handleGuiFontVariable(quint32 msgid, quint64 fun, const QVariant& va
 
 Shell::~Shell()
 {
+	if (m_nvim && m_nvim->redrawHandler() == this) {
+		m_nvim->setRedrawHandler(nullptr);
+	}
+
 	if (m_nvim && m_attached) {
 		m_nvim->api0()->ui_detach();
 	}
@@ -341,6 +361,7 @@ void Shell::init()
 	}
 	connect(m_nvim->api0(), &NeovimApi0::neovimNotification,
 			this, &Shell::handleNeovimNotification);
+	m_nvim->setRedrawHandler(this);
 	connect(m_nvim->api0(), &NeovimApi0::on_ui_try_resize,
 			this, &Shell::neovimResizeFinished);
 
@@ -357,6 +378,14 @@ void Shell::init()
 	if (m_options.IsLineGridEnabled() && m_nvim->hasUIOption("ext_linegrid")) {
 		options.insert("ext_linegrid", true);
 	}
+
+	// Multigrid builds on the linegrid events
+	const bool hasMultigrid{ options.contains("ext_linegrid")
+		&& m_options.IsMultigridEnabled() && m_nvim->hasUIOption("ext_multigrid") };
+	if (hasMultigrid) {
+		options.insert("ext_multigrid", true);
+	}
+	setMultigridEnabled(hasMultigrid);
 	options.insert("rgb", true);
 
 	MsgpackRequest* req{ nullptr };
@@ -373,11 +402,13 @@ void Shell::init()
 
 	connect(req, &MsgpackRequest::finished, this, &Shell::setAttached);
 
-	// Subscribe to GUI events
-	m_nvim->api0()->vim_subscribe("Gui");
+	// Subscribe to GUI events. The results are not used, notifications avoid a
+	// round trip and a failure is reported through nvim_error_event.
+	m_nvim->notify("vim_subscribe", { QByteArray{ "Gui" } });
 
 	// Set initial value
-	m_nvim->api0()->vim_set_var("GuiWindowFrameless", (windowFlags() & Qt::FramelessWindowHint) ? 1: 0);
+	m_nvim->notify("vim_set_var", { QByteArray{ "GuiWindowFrameless" },
+		(windowFlags() & Qt::FramelessWindowHint) ? 1 : 0 });
 
 	// Make the shell visible even when default_colors_set is not received,
 	// e.g. when using the older cell-based grid protocol.
@@ -502,7 +533,7 @@ void Shell::handleScroll(const QVariantList& args)
 
 	if (m_scroll_region.contains(m_cursor_pos)) {
 		// Schedule cursor region to be repainted
-		update(neovimCursorRect());
+		updateNeovimCursorCell();
 	}
 
 	scrollShellRegion(m_scroll_region.top(), m_scroll_region.bottom(),
@@ -625,7 +656,8 @@ void Shell::handleRedraw(const QByteArray& name, const QVariantList& opargs)
 	} else if (name == "mode_info_set") {
 		handleModeInfoSet(opargs);
 	} else if (name == "flush") {
-		// Do Nothing, a notification that nvim is done redrawing.
+		// Neovim is done redrawing, present the frame.
+		flushFrame();
 	} else if (name == "grid_resize") {
 		handleGridResize(opargs);
 	} else if (name == "default_colors_set") {
@@ -635,13 +667,21 @@ void Shell::handleRedraw(const QByteArray& name, const QVariantList& opargs)
 	} else if (name == "grid_line") {
 		handleGridLine(opargs);
 	} else if (name == "grid_clear") {
-		clearShell();
+		handleGridClear(opargs.value(0).toULongLong());
 	} else if (name == "grid_destroy") {
-		qDebug() << "Not implemented grid_destroy:" << opargs;
+		destroyGrid(opargs.value(0).toULongLong());
 	} else if (name == "grid_cursor_goto") {
 		handleGridCursorGoto(opargs);
 	} else if (name == "grid_scroll") {
 		handleGridScroll(opargs);
+	} else if (name == "win_pos") {
+		handleWinPos(opargs);
+	} else if (name == "win_float_pos") {
+		handleWinFloatPos(opargs);
+	} else if (name == "win_hide" || name == "win_close") {
+		hideGrid(opargs.value(0).toULongLong());
+	} else if (name == "msg_set_pos") {
+		handleMsgSetPos(opargs);
 	} else if (name == "hl_group_set") {
 		handleHighlightGroupSet(opargs);
 	} else {
@@ -743,7 +783,7 @@ void Shell::handleModeChange(const QVariantList& opargs)
 			m_cursor.SetTimer(0, 0, 0);
 		}
 
-		update(neovimCursorRect());
+		updateNeovimCursorCell();
 		return;
 	}
 
@@ -799,14 +839,14 @@ void Shell::handleModeChange(const QVariantList& opargs)
 	const QVariant attr_id{ modePropertyMap.value("attr_id") };
 	HighlightAttribute highlight;
 	if (!attr_id.isNull() && attr_id.canConvert<uint32_t>()) {
-		highlight = m_highlightMap.value(attr_id.toUInt());
+		highlight = contents().highlights().Get(attr_id.toUInt());
 	}
 
 	m_cursor.SetColor(highlight);
 	m_cursor.SetStyle(cursorShape, cellPercentage);
 	m_cursor.SetTimer(blinkWaitTime, blinkOnTime, blinkOffTime);
 
-	update(neovimCursorRect());
+	updateNeovimCursorCell();
 }
 
 void Shell::handleModeInfoSet(const QVariantList& opargs)
@@ -841,7 +881,7 @@ void Shell::handleBusy(bool busy)
 	m_cursor.SetIsBusy(busy);
 
 	if (busy != m_neovimBusy) {
-		update(neovimCursorRect());
+		updateNeovimCursorCell();
 	}
 
 	m_neovimBusy = busy;
@@ -853,6 +893,12 @@ void Shell::handleBusy(bool busy)
 // FIXME: fix QVariant type conversions
 void Shell::handleNeovimNotification(const QByteArray &name, const QVariantList& args)
 {
+	// Errors for calls sent with NeovimConnector::notify()
+	if (name == "nvim_error_event") {
+		qWarning() << "Neovim error:" << args;
+		return;
+	}
+
 	if (name == "Gui" && args.size() > 0) {
 		QString guiEvName = m_nvim->decode(args.at(0).toByteArray());
 		if (guiEvName == "Font") {
@@ -951,6 +997,11 @@ void Shell::handleNeovimNotification(const QByteArray &name, const QVariantList&
 		return;
 	}
 
+	// Redraw events are delivered through MsgpackRedrawHandler
+	if (m_nvim->redrawHandler() == this) {
+		return;
+	}
+
 	DispatchRedrawNotifications(this, args);
 }
 
@@ -1107,13 +1158,15 @@ void Shell::handleGridResize(const QVariantList& opargs)
 		return;
 	}
 
-	// Unused parameters:
-	//     "grid" = opargs.at(0).toULongLong()
-
+	const uint64_t grid = opargs.at(0).toULongLong();
 	const uint64_t width = opargs.at(1).toULongLong();
 	const uint64_t height = opargs.at(2).toULongLong();
 
-	handleResize(width, height);
+	// Without multigrid every grid is the default grid
+	if (grid == DefaultGridId || !isMultigridEnabled()) {
+		handleResize(width, height);
+	}
+	resizeGrid(grid, height, width);
 }
 
 void Shell::handleDefaultColorsSet(const QVariantList& opargs)
@@ -1173,8 +1226,7 @@ void Shell::handleHighlightAttributeDefine(const QVariantList& opargs)
 	const uint64_t id = opargs.at(0).toULongLong();
 	const QVariantMap rgb_attr = opargs.at(1).toMap();
 
-	HighlightAttribute hl_attr{ rgb_attr };
-	m_highlightMap.insert(id, hl_attr);
+	defineHighlight(static_cast<uint32_t>(id), HighlightAttribute{ rgb_attr });
 }
 
 void Shell::handleHighlightGroupSet(const QVariantList& opargs) noexcept
@@ -1203,13 +1255,16 @@ void Shell::handleGridLine(const QVariantList& opargs)
 		return;
 	}
 
-	// Unused parameters:
-	//     "grid" = opargs.at(0).toULongLong()
-
+	const uint64_t grid = opargs.at(0).toULongLong();
 	const uint64_t row = opargs.at(1).toULongLong();
 	const uint64_t col_start = opargs.at(2).toULongLong();
 	const QVariantList& cells = opargs.at(3).toList();
 
+	if (isMultigridEnabled()) {
+		handleGridLine(grid, row, col_start, cells);
+		return;
+	}
+
 	// Last used hl_attr, default ctor triggers default highlight/style.
 	HighlightAttribute hl_attr;
 
@@ -1225,7 +1280,7 @@ void Shell::handleGridLine(const QVariantList& opargs)
 
 			// Entry for 'hl_id == 0' is intentionally absent.
 			// Any unknown key triggers the default highlight/style.
-			hl_attr = m_highlightMap.value(hl_id);
+			hl_attr = contents().highlights().Get(static_cast<uint32_t>(hl_id));
 		}
 
 		// Optional repeat count, default is 1.
@@ -1243,6 +1298,86 @@ void Shell::handleGridLine(const QVariantList& opargs)
 	}
 }
 
+void Shell::handleGridLine(uint64_t grid, uint64_t row, uint64_t col_start,
+	const QVariantList& cells)
+{
+	// The cell text is referenced by the LineCells and must outlive putGridLine
+	std::vector<QByteArray> text;
+	text.reserve(cells.size());
+
+	m_gridLineCells.clear();
+	m_gridLineCells.reserve(cells.size());
+
+	uint32_t hl_id{ HighlightTable::DefaultId };
+	for (const auto& cell : cells) {
+		const QVariantList& cellPropertyList = cell.toList();
+		if (cellPropertyList.isEmpty()) {
+			continue;
+		}
+
+		text.push_back(cellPropertyList[0].toByteArray());
+
+		if (cellPropertyList.size() > 1) {
+			hl_id = static_cast<uint32_t>(cellPropertyList[1].toULongLong());
+		}
+
+		int repeat = 1;
+		if (cellPropertyList.size() > 2) {
+			repeat = cellPropertyList[2].toInt();
+		}
+
+		m_gridLineCells.push_back({ text.back().constData(), static_cast<int>(text.back().size()),
+			hl_id, repeat });
+	}
+
+	putGridLine(grid, row, col_start, m_gridLineCells.data(), m_gridLineCells.size());
+}
+
+void Shell::handleGridLine(const GridLineEvent& ev)
+{
+	m_gridLineCells.clear();
+	m_gridLineCells.reserve(ev.cells.size());
+
+	// Last used hl_id, the default highlight/style is 0. Unknown ids
+	// are also rendered with the default highlight/style.
+	uint32_t hl_id{ HighlightTable::DefaultId };
+
+	for (const GridLineCell& cell : ev.cells) {
+		if (cell.hasHighlightId) {
+			hl_id = static_cast<uint32_t>(cell.highlightId);
+		}
+
+		m_gridLineCells.push_back({ cell.text.data(), static_cast<int>(cell.text.size()),
+			hl_id, static_cast<int>(cell.repeat) });
+	}
+
+	putGridLine(ev.grid, ev.row, ev.colStart, m_gridLineCells.data(), m_gridLineCells.size());
+}
+
+void Shell::handleGridCursorGoto(uint64_t grid, uint64_t row, uint64_t col)
+{
+	// The cursor is drawn in shell coordinates
+	const QPoint origin{ gridPosition(grid) };
+	setNeovimCursor(row + origin.y(), col + origin.x());
+	qApp->inputMethod()->update(Qt::ImCursorRectangle);
+}
+
+void Shell::handleGridClear(uint64_t grid)
+{
+	clearGrid(grid);
+}
+
+void Shell::handleFlush()
+{
+	// Neovim is done redrawing, present the frame.
+	flushFrame();
+}
+
+void Shell::handleRedrawEvent(const QByteArray& name, const QVariantList& args)
+{
+	handleRedraw(name, args);
+}
+
 void Shell::handleGridCursorGoto(const QVariantList& opargs)
 {
 	if (opargs.size() < 3
@@ -1252,14 +1387,11 @@ void Shell::handleGridCursorGoto(const QVariantList& opargs)
 		return;
 	}
 
-	// Unused parameters:
-	//     "grid" = opargs.at(0).toULongLong()
-
+	const uint64_t grid = opargs.at(0).toULongLong();
 	const uint64_t row = opargs.at(1).toULongLong();
 	const uint64_t column = opargs.at(2).toULongLong();
 
-	setNeovimCursor(row, column);
-	qApp->inputMethod()->update(Qt::ImCursorRectangle);
+	handleGridCursorGoto(grid, row, column);
 }
 
 void Shell::handleGridScroll(const QVariantList& opargs)
@@ -1277,27 +1409,111 @@ void Shell::handleGridScroll(const QVariantList& opargs)
 	}
 
 	// Unused parameters:
-	//     "grid" = opargs.at(0).toULongLong()
 	//     "cols" = opargs.at(6).toULongLong()
 
+	const uint64_t grid{ opargs.at(0).toULongLong() };
 	const uint64_t top{ opargs.at(1).toULongLong() };
 	const uint64_t bot{ opargs.at(2).toULongLong() };
 	const uint64_t left{ opargs.at(3).toULongLong() };
 	const uint64_t right{ opargs.at(4).toULongLong() };
 	const int64_t rows{ opargs.at(5).toLongLong() };
 
-	m_scroll_region = QRect(QPoint(left, top), QPoint(right, bot));
+	m_scroll_region = QRect(QPoint(left, top), QPoint(right, bot))
+		.translated(gridPosition(grid));
 
 	// Remove old cursor
 	if (m_scroll_region.contains(m_cursor_pos)) {
-		update(neovimCursorRect());
+		updateNeovimCursorCell();
 	}
 
-	scrollShellRegion(m_scroll_region.top(), m_scroll_region.bottom(),
-		m_scroll_region.left(), m_scroll_region.right(), rows);
+	scrollGridRegion(grid, top, bot, left, right, rows);
 
 	// Draw new cursor
-	update(neovimCursorRect());
+	updateNeovimCursorCell();
+}
+
+void Shell::handleWinPos(const QVariantList& opargs) noexcept
+{
+	if (opargs.size() < 4
+		|| !opargs.at(0).canConvert<uint64_t>()
+		|| !opargs.at(2).canConvert<int>()
+		|| !opargs.at(3).canConvert<int>()) {
+		qWarning() << "Unexpected arguments for win_pos:" << opargs;
+		return;
+	}
+
+	// Unused parameters:
+	//     "win" = opargs.at(1)
+	//     "width" = opargs.at(4).toInt()
+	//     "height" = opargs.at(5).toInt()
+
+	const uint64_t grid{ opargs.at(0).toULongLong() };
+	const int startRow{ opargs.at(2).toInt() };
+	const int startCol{ opargs.at(3).toInt() };
+
+	setGridPosition(grid, startRow, startCol, c_windowZIndex);
+}
+
+void Shell::handleWinFloatPos(const QVariantList& opargs) noexcept
+{
+	if (opargs.size() < 6
+		|| !opargs.at(0).canConvert<uint64_t>()
+		|| opargs.at(2).type() != QVariant::Type::ByteArray
+		|| !opargs.at(3).canConvert<uint64_t>()
+		|| !opargs.at(4).canConvert<double>()
+		|| !opargs.at(5).canConvert<double>()) {
+		qWarning() << "Unexpected arguments for win_float_pos:" << opargs;
+		return;
+	}
+
+	// Unused parameters:
+	//     "win" = opargs.at(1)
+	//     "focusable" = opargs.at(6).toBool()
+
+	const uint64_t grid{ opargs.at(0).toULongLong() };
+	const QByteArray anchor{ opargs.at(2).toByteArray() };
+	const uint64_t anchorGrid{ opargs.at(3).toULongLong() };
+	const double anchorRow{ opargs.at(4).toDouble() };
+	const double anchorCol{ opargs.at(5).toDouble() };
+	const int zindex{ (opargs.size() > 7) ? opargs.at(7).toInt() : c_floatZIndex };
+
+	// The anchor is the corner of the float placed at (anchorRow, anchorCol)
+	// of the anchor grid, e.g. "SE" is the bottom right corner.
+	const QRect floatRect{ gridRect(grid) };
+	const QPoint origin{ gridRect(anchorGrid).topLeft() };
+	int row{ origin.y() + static_cast<int>(anchorRow) };
+	int col{ origin.x() + static_cast<int>(anchorCol) };
+	if (anchor.startsWith('S')) {
+		row -= floatRect.height();
+	}
+	if (anchor.endsWith('E')) {
+		col -= floatRect.width();
+	}
+
+	// Keep the float inside the shell, like the Neovim compositor
+	row = qMax(0, qMin(row, rows() - floatRect.height()));
+	col = qMax(0, qMin(col, columns() - floatRect.width()));
+
+	setGridPosition(grid, row, col, zindex);
+}
+
+void Shell::handleMsgSetPos(const QVariantList& opargs) noexcept
+{
+	if (opargs.size() < 2
+		|| !opargs.at(0).canConvert<uint64_t>()
+		|| !opargs.at(1).canConvert<int>()) {
+		qWarning() << "Unexpected arguments for msg_set_pos:" << opargs;
+		return;
+	}
+
+	// Unused parameters:
+	//     "scrolled" = opargs.at(2).toBool()
+	//     "sep_char" = opargs.at(3)
+
+	const uint64_t grid{ opargs.at(0).toULongLong() };
+	const int row{ opargs.at(1).toInt() };
+
+	setGridPosition(grid, row, 0, c_messageZIndex);
 }
 
 void Shell::handleGuiAdaptiveColor(const QVariantList& opargs) noexcept
@@ -1404,7 +1620,7 @@ void Shell::keyPressEvent(QKeyEvent *ev)
 		return;
 	}
 
-	m_nvim->api0()->vim_input(m_nvim->encode(inp));
+	m_nvim->notify("vim_input", { m_nvim->encode(inp) });
 	// FIXME: bytes might not be written, and need to be buffered
 }
 
@@ -1436,7 +1652,7 @@ void Shell::neovimMouseEvent(QMouseEvent *ev)
 	if (inp.isEmpty()) {
 		return;
 	}
-	m_nvim->api0()->vim_input(inp.toLatin1());
+	m_nvim->notify("vim_input", { inp.toLatin1() });
 }
 void Shell::mousePressEvent(QMouseEvent *ev)
 {
@@ -1514,7 +1730,7 @@ void Shell::wheelEvent(QWheelEvent *ev)
 		return;
 	}
 
-	m_nvim->api0()->vim_input(evString.toLatin1());
+	m_nvim->notify("vim_input", { evString.toLatin1() });
 }
 
 /*static*/ QString Shell::GetWheelEventStringAndSetScrollRemainder(
@@ -1768,7 +1984,7 @@ void Shell::inputMethodEvent(QInputMethodEvent *ev)
 	}
 	if ( !ev->commitString().isEmpty() ) {
 		QByteArray s = m_nvim->encode(ev->commitString());
-		m_nvim->api0()->vim_input(s);
+		m_nvim->notify("vim_input", { s });
 		tooltip("");
 	} else {
 		tooltip(ev->preeditString());
@@ -10,6 +10,7 @@
 #include <QVariantList>
 #include <QWidget>
 
+#include "msgpackredraw.h"
 #include "neovimconnector.h"
 #include "popupmenu.h"
 #include "popupmenumodel.h"
@@ -21,7 +22,7 @@
 
 namespace NeovimQt {
 
-class Shell: public ShellWidget
+class Shell: public ShellWidget, public MsgpackRedrawHandler
 {
 	Q_OBJECT
 	Q_PROPERTY(bool isNeovimBusy READ isNeovimBusy() NOTIFY neovimBusyChanged(bool))
@@ -53,14 +54,14 @@ public:
 	HighlightAttribute GetHighlightGroup(const QString& name) const noexcept
 	{
 		const uint64_t hl_id{ m_highlightGroupNameMap.value(name) };
-		return m_highlightMap.value(hl_id);
+		return contents().highlights().Get(static_cast<uint32_t>(hl_id));
 	}
 
 	/// Check if highlight exists in hl_group_set
 	bool IsHighlightGroup(const QString& name) const noexcept
 	{
 		const uint64_t hl_id{ m_highlightGroupNameMap.value(name) };
-		return m_highlightMap.contains(hl_id);
+		return contents().highlights().IsDefined(static_cast<uint32_t>(hl_id));
 	}
 
 	ShellOptions& GetShellOptions() noexcept { return m_options; }
@@ -167,6 +168,18 @@ protected:
 	virtual void handleGridCursorGoto(const QVariantList& opargs);
 	virtual void handleGridScroll(const QVariantList& opargs);
 
+	// Multigrid 'ext_multigrid' UI Events
+	virtual void handleWinPos(const QVariantList& opargs) noexcept;
+	virtual void handleWinFloatPos(const QVariantList& opargs) noexcept;
+	virtual void handleMsgSetPos(const QVariantList& opargs) noexcept;
+
+	// MsgpackRedrawHandler, typed 'ext_linegrid' events
+	void handleGridLine(const GridLineEvent& ev) override;
+	void handleGridCursorGoto(uint64_t grid, uint64_t row, uint64_t col) override;
+	void handleGridClear(uint64_t grid) override;
+	void handleFlush() override;
+	void handleRedrawEvent(const QByteArray& name, const QVariantList& args) override;
+
 	// GuiAdaptive Color/Font
 	virtual void handleGuiAdaptiveColor(const QVariantList& opargs) noexcept;
 	virtual void handleGuiAdaptiveFont(const QVariantList& opargs) noexcept;
@@ -193,6 +206,10 @@ private slots:
 	void ensureVisible() noexcept;
 
 private:
+	/// 'grid_line' with the cells decoded as QVariant, see putGridLine()
+	void handleGridLine(uint64_t grid, uint64_t row, uint64_t col_start,
+		const QVariantList& cells);
+
 	bool m_init_called{ false };
 	bool m_attached{ false };
 	bool m_shown{ false };
@@ -214,10 +231,10 @@ private:
 	QColor m_hg_background{ Qt:: white };
 	QColor m_hg_special;
 
-	/// Modern 'ext_linegrid' highlight definition map
-	QMap<uint64_t, HighlightAttribute> m_highlightMap;
+	/// Reusable buffer for the cells of a single grid_line event
+	std::vector<LineCell> m_gridLineCells;
 
-	/// Storage for hl_group_set, maps to hl_id in m_highlightMap
+	/// Storage for hl_group_set, maps to a highlight id of the shell contents
 	QMap<QString, uint64_t> m_highlightGroupNameMap;
 
 	/// Neovim mode descriptions from "mode_change", used by guicursor
@@ -2,41 +2,33 @@
 
 /*static*/ Cell Cell::MakeInvalidCell()
 {
-	Cell invalidCell;
-	invalidCell.m_character = 'X';
-	invalidCell.m_isValid = false;
-	invalidCell.m_highlight = { Qt::white, Qt::red, QColor::Invalid,
-		false, false, false, false, false, false };
+	Cell invalidCell{ 'X', HighlightTable::InvalidId };
+	invalidCell.m_data |= c_invalidFlag;
 
 	return invalidCell;
 }
 
 void Cell::SetCharacter(uint character)
 {
-	m_character = character;
-	m_isDoubleWidth = konsole_wcwidth(character) > 1;
+	m_data = (m_data & c_invalidFlag) | (character & c_characterMask);
+	if (konsole_wcwidth(character) > 1) {
+		m_data |= c_doubleWidthFlag;
+	}
 }
 
 bool Cell::IsStyleEquivalent(const Cell& other) const
 {
-	if (!m_isValid || !other.m_isValid) {
-		return false;
-	}
-
-	if (IsDoubleWidth() != other.IsDoubleWidth()) {
-		return false;
-	}
-
-	return m_highlight == other.m_highlight;
+	// Valid and double-width flags must match, clusters may share a run with
+	// single code points.
+	constexpr uint32_t flagsMask{ c_invalidFlag | c_doubleWidthFlag };
+	return ((m_data | other.m_data) & c_invalidFlag) == 0
+		&& (m_data & flagsMask) == (other.m_data & flagsMask)
+		&& m_highlightId == other.m_highlightId;
 }
 
 bool Cell::operator==(const Cell& other) const
 {
-	if (!m_isValid || !other.m_isValid) {
-		return false;
-	}
-
-	return m_character == other.m_character &&
-		m_isDoubleWidth == other.m_isDoubleWidth &&
-		m_highlight == other.m_highlight;
+	return ((m_data | other.m_data) & c_invalidFlag) == 0
+		&& m_data == other.m_data
+		&& m_highlightId == other.m_highlightId;
 }
@@ -3,82 +3,80 @@
 #include "highlight.h"
 #include "konsole_wcwidth.h"
 
-#include <QColor>
+#include <cstdint>
 
+/// A single grid cell. Styles are stored in the HighlightTable of the owning
+/// ShellContents, the cell only holds the highlight id.
 class Cell {
 public:
-	/// Create a cell having a specified HighlightAttribute
-	Cell(uint character, const HighlightAttribute& attribute) noexcept :
-		m_highlight(attribute)
+	/// Create a cell having a specified highlight id
+	Cell(uint character, uint32_t highlightId) noexcept :
+		m_highlightId{ highlightId }
 	{
 		SetCharacter(character);
 	}
 
-	Cell(
-		uint character,
-		QColor fgColor,
-		QColor bgColor,
-		QColor spColor,
-		bool bold,
-		bool italic,
-		bool underline,
-		bool undercurl,
-		bool strikethrough,
-		bool reverse) noexcept :
-		Cell{
-			character,
-			{ fgColor, bgColor, spColor, reverse, italic, bold, underline, undercurl, strikethrough } }
-	{
-	}
-
-	/// Create an empty Cell with a background color
-	Cell(QColor bgColor) noexcept :
-		Cell{
-			' ',
-			{ QColor::Invalid, bgColor, QColor::Invalid, false, false, false, false, false, false } }
-	{
-	}
-
-	/// Default cells are space characters using invalid/default colors
+	/// Default cells are space characters using the default highlight
 	Cell() = default;
 
 	/// Create a cell marked as invalid
 	static Cell MakeInvalidCell();
 
-	void SetCharacter(uint character);
-
-	uint GetCharacter() const { return m_character; };
-
-	bool IsDoubleWidth() const { return m_isDoubleWidth; };
+	/// Create a space with a highlight id, the same as Cell{ ' ', highlightId }
+	/// without the character width lookup. Used as template to clear cells.
+	static Cell MakeBlankCell(uint32_t highlightId) noexcept
+	{
+		Cell blank;
+		blank.m_highlightId = highlightId;
+		return blank;
+	}
 
-	QColor GetForegroundColor() const { return m_highlight.GetForegroundColor(); }
+	/// Create a cell showing a grapheme cluster, `clusterId` is an id from the
+	/// ClusterTable of the owning ShellContents.
+	static Cell MakeClusterCell(uint32_t clusterId, bool isDoubleWidth, uint32_t highlightId) noexcept
+	{
+		Cell cell;
+		cell.m_data = (clusterId & c_characterMask) | c_clusterFlag;
+		if (isDoubleWidth) {
+			cell.m_data |= c_doubleWidthFlag;
+		}
+		cell.m_highlightId = highlightId;
+		return cell;
+	}
 
-	QColor GetBackgroundColor() const { return m_highlight.GetBackgroundColor(); }
+	void SetCharacter(uint character);
 
-	QColor GetSpecialColor() const { return m_highlight.GetSpecialColor(); }
+	/// The code point, or the cluster id for cluster cells
+	uint GetCharacter() const { return m_data & c_characterMask; };
 
-	bool IsReverse() const { return m_highlight.IsReverse(); }
+	bool IsCluster() const { return (m_data & c_clusterFlag) != 0; };
 
-	bool IsItalic() const { return m_highlight.IsItalic(); }
+	uint32_t GetClusterId() const { return m_data & c_characterMask; };
 
-	bool IsBold() const { return m_highlight.IsBold(); }
+	bool IsDoubleWidth() const { return (m_data & c_doubleWidthFlag) != 0; };
 
-	bool IsUnderline() const { return m_highlight.IsUnderline(); }
+	bool IsValid() const { return (m_data & c_invalidFlag) == 0; };
 
-	bool IsUndercurl() const { return m_highlight.IsUndercurl(); }
+	uint32_t GetHighlightId() const { return m_highlightId; }
 
-	bool IsStrikeThrough() const { return m_highlight.IsStrikeThrough(); }
+	void SetHighlightId(uint32_t highlightId) { m_highlightId = highlightId; }
 
-	/// Checks two cells for style equivalence, ignore differences in `m_character`
+	/// Checks two cells for style equivalence, ignore differences in the character
 	bool IsStyleEquivalent(const Cell& other) const;
 
-	/// Two cells are equal if both are valid, and all attributes are the same
+	/// Two cells are equal if both are valid, and all attributes are the same.
+	/// Clusters are interned, cells with the same text share the same id.
 	bool operator==(const Cell& other) const;
 
 private:
-	uint m_character{ ' ' };
-	bool m_isValid{ true };
-	bool m_isDoubleWidth{ false };
-
-	HighlightAttribute m_highlight;
+	// Code points use 21 bits, the upper bits hold the cell flags
+	static constexpr uint32_t c_characterMask{ 0x001FFFFF };
+	static constexpr uint32_t c_clusterFlag{ 0x20000000 };
+	static constexpr uint32_t c_doubleWidthFlag{ 0x40000000 };
+	static constexpr uint32_t c_invalidFlag{ 0x80000000 };
+
+	uint32_t m_data{ ' ' };
+	uint32_t m_highlightId{ HighlightTable::DefaultId };
 };
+
+static_assert(sizeof(Cell) == 8, "Cell should be kept small, it is copied in bulk");
@@ -0,0 +1,89 @@
+#include "clustertable.h"
+
+#include "konsole_wcwidth.h"
+
+/*static*/ constexpr uint32_t ClusterTable::MaxCount;
+/*static*/ constexpr uint32_t ClusterTable::InvalidId;
+
+uint32_t ClusterTable::Intern(const char* text, int size) noexcept
+{
+	const auto it = m_ids.constFind(QByteArray::fromRawData(text, size));
+	if (it != m_ids.constEnd()) {
+		return it.value();
+	}
+
+	if (m_freeIds.empty() && m_clusters.size() >= MaxCount) {
+		return InvalidId;
+	}
+
+	const QString cluster{ QString::fromUtf8(text, size) };
+	const QVector<uint> characters{ cluster.toUcs4() };
+	const uint first{ characters.value(0, 0xFFFD) };
+	const bool isDoubleWidth{ konsole_wcwidth(first) > 1 || characters.contains(0xFE0F) };
+
+	uint32_t id;
+	if (!m_freeIds.empty()) {
+		id = m_freeIds.back();
+		m_freeIds.pop_back();
+		m_clusters[id] = { cluster, first, isDoubleWidth };
+	} else {
+		id = static_cast<uint32_t>(m_clusters.size());
+		m_clusters.push_back({ cluster, first, isDoubleWidth });
+	}
+
+	m_ids.insert(QByteArray{ text, size }, id);
+	return id;
+}
+
+void ClusterTable::Release(const std::vector<bool>& isUsed) noexcept
+{
+	auto used = [&](size_t id) noexcept {
+		return id < isUsed.size() && isUsed[id];
+	};
+
+	// Trailing clusters are dropped, the others become free slots
+	size_t size{ m_clusters.size() };
+	while (size > 0 && !used(size - 1)) {
+		size--;
+	}
+	m_clusters.resize(size);
+
+	// The keys are the UTF-8 text received from Neovim, keep them as they are
+	for (auto it = m_ids.begin(); it != m_ids.end();) {
+		if (used(it.value())) {
+			++it;
+		} else {
+			it = m_ids.erase(it);
+		}
+	}
+
+	m_freeIds.clear();
+	for (size_t i=0; i<size; i++) {
+		if (!used(i)) {
+			m_clusters[i] = {};
+			m_freeIds.push_back(static_cast<uint32_t>(i));
+		}
+	}
+}
+
+const QString& ClusterTable::GetText(uint32_t id) const noexcept
+{
+	static const QString invalid{ QChar{ 0xFFFD } };
+	if (id >= m_clusters.size()) {
+		return invalid;
+	}
+	return m_clusters[id].text;
+}
+
+uint ClusterTable::GetFirstCharacter(uint32_t id) const noexcept
+{
+	if (id >= m_clusters.size()) {
+		return 0xFFFD;
+	}
+	return m_clusters[id].firstCharacter;
+}
+
+bool ClusterTable::IsDoubleWidth(uint32_t id) const noexcept
+{
+	return id < m_clusters.size() && m_clusters[id].isDoubleWidth;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <vector>
+
+/// Storage for grid cells made of more than one code point, e.g. a letter
+/// with combining marks, an emoji ZWJ sequence or a variation selector. Cells
+/// only keep an id, see Cell::MakeClusterCell().
+///
+/// Clusters are interned, identical text shares the same id. The table is
+/// shared by all the contents of a shell, cells can be copied between them.
+class ClusterTable {
+public:
+	/// Ids must fit in the character bits of a Cell
+	static constexpr uint32_t MaxCount{ 0x200000 };
+
+	/// Returned by Intern() when the table is full
+	static constexpr uint32_t InvalidId{ 0xFFFFFFFF };
+
+	/// Returns an id for the UTF-8 encoded `text`, InvalidId if the table is full.
+	uint32_t Intern(const char* text, int size) noexcept;
+
+	uint32_t Intern(const QString& text) noexcept
+	{
+		const QByteArray utf8{ text.toUtf8() };
+		return Intern(utf8.constData(), utf8.size());
+	}
+
+	const QString& GetText(uint32_t id) const noexcept;
+
+	/// The first code point, used to pick a font for the cluster
+	uint GetFirstCharacter(uint32_t id) const noexcept;
+
+	/// True if the cluster uses two cells, when the first code point is wide or
+	/// the emoji presentation selector U+FE0F is used.
+	bool IsDoubleWidth(uint32_t id) const noexcept;
+
+	/// Number of clusters, released clusters are not counted
+	int Count() const noexcept
+	{
+		return static_cast<int>(m_clusters.size() - m_freeIds.size());
+	}
+
+	/// Release the clusters not marked in `isUsed`, indexed by id. Released
+	/// ids are reused by Intern(), no cell may still reference them.
+	void Release(const std::vector<bool>& isUsed) noexcept;
+
+private:
+	struct Cluster
+	{
+		QString text;
+		uint firstCharacter;
+		bool isDoubleWidth;
+	};
+
+	std::vector<Cluster> m_clusters;
+	QHash<QByteArray, uint32_t> m_ids;
+
+	/// Released slots of m_clusters
+	std::vector<uint32_t> m_freeIds;
+};
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""
+Generates konsole_wcwidth_table.h, a two level lookup table for
+konsole_wcwidth(). The widths come from the interval tables in
+konsole_wcwidth.cpp, update those first when moving to a newer Unicode
+version and run this script again.
+
+    python3 generate_wcwidth_table.py [konsole_wcwidth.cpp] [output.h]
+"""
+
+import os
+import re
+import sys
+
+MAX_CODE_POINT = 0x10FFFF
+BLOCK_SHIFT = 8
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+# Widths are stored as width + 1 in 2 bits, 4 code points per byte
+CODE_POINTS_PER_BYTE = 4
+
+
+def parse_intervals(source, name):
+    """Read the (first, last) pairs of a 'struct interval' array"""
+    m = re.search(r'static const struct interval ' + name + r'\[\] = \{(.*?)\};',
+            source, re.S)
+    if not m:
+        raise ValueError('Missing interval table ' + name)
+    return [(int(a, 16), int(b, 16))
+            for a, b in re.findall(r'\{\s*(0x[0-9a-fA-F]+),\s*(0x[0-9a-fA-F]+)\s*\}', m.group(1))]
+
+
+def compute_widths(source):
+    """Width of every code point, following konsole_wcwidth()"""
+    widths = bytearray([1]) * (MAX_CODE_POINT + 1)
+
+    # Later tables take precedence, the checks run in reverse order
+    for name, width in (('emoji_width', 2), ('doublewidth', 2), ('combining', 0)):
+        for first, last in parse_intervals(source, name):
+            for ucs in range(first, min(last, MAX_CODE_POINT) + 1):
+                widths[ucs] = width
+
+    widths = [w for w in widths]
+    for ucs in list(range(1, 32)) + list(range(0x7f, 0xa0)):
+        widths[ucs] = -1
+    widths[0] = 0
+    return widths
+
+
+def pack_block(widths):
+    packed = []
+    for i in range(0, len(widths), CODE_POINTS_PER_BYTE):
+        byte = 0
+        for j, w in enumerate(widths[i:i + CODE_POINTS_PER_BYTE]):
+            byte |= (w + 1) << (2 * j)
+        packed.append(byte)
+    return tuple(packed)
+
+
+def build_table(widths):
+    blocks = []
+    block_ids = {}
+    index = []
+    for start in range(0, MAX_CODE_POINT + 1, BLOCK_SIZE):
+        block = pack_block(widths[start:start + BLOCK_SIZE])
+        if block not in block_ids:
+            block_ids[block] = len(blocks)
+            blocks.append(block)
+        index.append(block_ids[block])
+    if len(blocks) > 256:
+        raise ValueError('Too many unique blocks for an 8 bit index')
+    return index, blocks
+
+
+def format_bytes(values, indent, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ', '.join('0x%02x' % v for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def generate(source):
+    index, blocks = build_table(compute_widths(source))
+    out = []
+    out.append('/* Generated by generate_wcwidth_table.py from konsole_wcwidth.cpp, do not edit */')
+    out.append('')
+    out.append('#pragma once')
+    out.append('')
+    out.append('/* Code points per block of wcwidth_blocks, as a shift */')
+    out.append('static const unsigned wcwidth_block_shift = %d;' % BLOCK_SHIFT)
+    out.append('')
+    out.append('/* Block of each range of code points, up to U+10FFFF */')
+    out.append('static const unsigned char wcwidth_index[%d] = {' % len(index))
+    out.append(format_bytes(index, '    '))
+    out.append('};')
+    out.append('')
+    out.append('/* Width + 1 of each code point, 2 bits per code point starting at the low bits */')
+    out.append('static const unsigned char wcwidth_blocks[%d][%d] = {' % (len(blocks), len(blocks[0])))
+    for block in blocks:
+        out.append('    {')
+        out.append(format_bytes(block, '        '))
+        out.append('    },')
+    out.append('};')
+    out.append('')
+    return '\n'.join(out)
+
+
+if __name__ == '__main__':
+    here = os.path.dirname(os.path.abspath(__file__))
+    src = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, 'konsole_wcwidth.cpp')
+    dst = sys.argv[2] if len(sys.argv) > 2 else os.path.join(here, 'konsole_wcwidth_table.h')
+    with open(src) as f:
+        table = generate(f.read())
+    with open(dst, 'w') as f:
+        f.write(table)
@@ -0,0 +1,56 @@
+#include "glyphcache.h"
+
+/// Maximum size of the cached images in KiB
+constexpr int c_glyphCacheMaxCost{ 16 * 1024 };
+
+GlyphCache::GlyphCache() noexcept
+	: m_glyphs{ c_glyphCacheMaxCost }
+{
+}
+
+/*static*/ quint64 GlyphCache::GetKey(uint character, uint32_t variant, QRgb color) noexcept
+{
+	// Code points use 21 bits, the variant is stored above them
+	return (static_cast<quint64>(color) << 32)
+		| (static_cast<quint64>(variant) << 21)
+		| (character & 0x1FFFFF);
+}
+
+QImage GlyphCache::Find(quint64 key) const noexcept
+{
+	const QImage* glyph{ m_glyphs.object(key) };
+	if (!glyph) {
+		return {};
+	}
+
+	return *glyph;
+}
+
+void GlyphCache::Insert(quint64 key, const QImage& glyph) noexcept
+{
+	const int cost{ glyph.bytesPerLine() * glyph.height() / 1024 + 1 };
+	m_glyphs.insert(key, new QImage{ glyph }, cost);
+}
+
+void GlyphCache::Clear() noexcept
+{
+	m_glyphs.clear();
+}
+
+void GlyphCache::Remove(uint32_t variant) noexcept
+{
+	const quint64 mask{ static_cast<quint64>(variant) << 21 };
+	for (const quint64 key : m_glyphs.keys()) {
+		if (key & mask) {
+			m_glyphs.remove(key);
+		}
+	}
+}
+
+void GlyphCache::SetDevicePixelRatio(qreal ratio) noexcept
+{
+	if (ratio != m_devicePixelRatio) {
+		m_devicePixelRatio = ratio;
+		m_glyphs.clear();
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <QCache>
+#include <QColor>
+#include <QImage>
+
+/// Rasterized glyphs for the non-ligature paint path. Each entry is a single
+/// character drawn with a given font variant and foreground color, over a
+/// transparent background.
+///
+/// The images depend on the shell font and cell size, the cache must be
+/// cleared when either changes.
+class GlyphCache
+{
+public:
+	/// Font style bits, a glyph is rasterized with a font built from these
+	enum Variant : uint32_t
+	{
+		Regular = 0x0,
+		Bold = 0x1,
+		Italic = 0x2,
+		DoubleWidth = 0x4,
+
+		/// The character is a ClusterTable id, not a code point
+		Cluster = 0x8,
+	};
+
+	GlyphCache() noexcept;
+
+	static quint64 GetKey(uint character, uint32_t variant, QRgb color) noexcept;
+
+	/// Returns a null image if the glyph is not cached
+	QImage Find(quint64 key) const noexcept;
+
+	void Insert(quint64 key, const QImage& glyph) noexcept;
+
+	void Clear() noexcept;
+
+	/// Remove the glyphs using any of the `variant` bits
+	void Remove(uint32_t variant) noexcept;
+
+	/// Cached images are only valid for a single device pixel ratio, the cache
+	/// is cleared when the ratio changes.
+	void SetDevicePixelRatio(qreal ratio) noexcept;
+
+	int Count() const noexcept { return m_glyphs.count(); }
+
+private:
+	QCache<quint64, QImage> m_glyphs;
+	qreal m_devicePixelRatio{ 1.0 };
+};
@@ -0,0 +1,35 @@
+#include "glyphruncache.h"
+
+/// Maximum number of cached text blocks
+constexpr int c_glyphRunCacheMaxCount{ 4096 };
+
+GlyphRunCache::GlyphRunCache() noexcept
+	: m_glyphRuns{ c_glyphRunCacheMaxCount }
+{
+}
+
+/*static*/ GlyphRunCache::Key GlyphRunCache::GetKey(
+	const QString& text,
+	int fontIndex,
+	int cellWidth) noexcept
+{
+	const quint64 layout{ (static_cast<quint64>(cellWidth) << 32)
+		| static_cast<quint32>(fontIndex) };
+
+	return { text, layout };
+}
+
+const QList<QGlyphRun>* GlyphRunCache::Find(const Key& key) const noexcept
+{
+	return m_glyphRuns.object(key);
+}
+
+void GlyphRunCache::Insert(const Key& key, const QList<QGlyphRun>& glyphRuns) noexcept
+{
+	m_glyphRuns.insert(key, new QList<QGlyphRun>(glyphRuns));
+}
+
+void GlyphRunCache::Clear() noexcept
+{
+	m_glyphRuns.clear();
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <QCache>
+#include <QGlyphRun>
+#include <QList>
+#include <QPair>
+#include <QString>
+
+/// Shaped glyph runs for the ligature paint path, the runs are stored after
+/// their positions have been distributed on the cell grid.
+///
+/// Entries depend on the cell fonts and cell size, the cache must be cleared
+/// when either changes.
+class GlyphRunCache
+{
+public:
+	/// Block text, and the packed cell font index and cell width
+	using Key = QPair<QString, quint64>;
+
+	GlyphRunCache() noexcept;
+
+	static Key GetKey(const QString& text, int fontIndex, int cellWidth) noexcept;
+
+	/// Returns nullptr if the text is not cached. The pointer is invalidated
+	/// by the next call to Insert or Clear.
+	const QList<QGlyphRun>* Find(const Key& key) const noexcept;
+
+	void Insert(const Key& key, const QList<QGlyphRun>& glyphRuns) noexcept;
+
+	void Clear() noexcept;
+
+	int Count() const noexcept { return m_glyphRuns.count(); }
+
+private:
+	QCache<Key, QList<QGlyphRun>> m_glyphRuns;
+};
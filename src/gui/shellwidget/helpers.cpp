@@ -50,12 +50,12 @@ bool saveShellContents(const ShellContents& s, const QString& filename)
 		for (int j=0; j<s.columns(); j++) {
 			QRect r(j*w, i*h, w, h);
 			const Cell& cell = s.constValue(i,j);
-			p.setPen(cell.GetForegroundColor());
-			if (cell.GetBackgroundColor().isValid()) {
-				p.fillRect(r, cell.GetBackgroundColor());
+			const HighlightAttribute& hl = s.highlight(cell);
+			p.setPen(hl.GetForegroundColor());
+			if (hl.GetBackgroundColor().isValid()) {
+				p.fillRect(r, hl.GetBackgroundColor());
 			}
-			const uint character{ cell.GetCharacter() };
-			p.drawText(r, QString::fromUcs4(&character, 1));
+			p.drawText(r, s.text(cell));
 		}
 	}
 	p.end();
@@ -55,3 +55,117 @@ bool HighlightAttribute::operator==(const HighlightAttribute& other) const noexc
 		m_undercurl == other.m_undercurl &&
 		m_strikethrough == other.m_strikethrough;
 }
+
+/*static*/ constexpr uint32_t HighlightTable::DefaultId;
+/*static*/ constexpr uint32_t HighlightTable::InvalidId;
+/*static*/ constexpr uint32_t HighlightTable::InternedIdBase;
+
+void HighlightTable::Define(uint32_t id, const HighlightAttribute& attr) noexcept
+{
+	if (id == DefaultId || id >= InternedIdBase) {
+		return;
+	}
+
+	if (id >= m_defined.size()) {
+		m_defined.resize(id + 1);
+		m_isDefined.resize(id + 1);
+	}
+
+	m_defined[id] = attr;
+	m_isDefined[id] = true;
+}
+
+/*static*/ HighlightTable::InternKey HighlightTable::GetInternKey(
+	const HighlightAttribute& attr) noexcept
+{
+	const quint64 colors{ (static_cast<quint64>(attr.m_foreground.rgba()) << 32)
+		| attr.m_background.rgba() };
+
+	const quint64 special{ (static_cast<quint64>(attr.m_special.rgba()) << 32)
+		| (attr.m_foreground.isValid() << 0)
+		| (attr.m_background.isValid() << 1)
+		| (attr.m_special.isValid() << 2)
+		| (attr.m_reverse << 3)
+		| (attr.m_italic << 4)
+		| (attr.m_bold << 5)
+		| (attr.m_underline << 6)
+		| (attr.m_undercurl << 7)
+		| (attr.m_strikethrough << 8) };
+
+	return { colors, special };
+}
+
+uint32_t HighlightTable::Intern(const HighlightAttribute& attr) noexcept
+{
+	static const HighlightAttribute defaultAttr;
+	if (attr == defaultAttr) {
+		return DefaultId;
+	}
+
+	const InternKey key{ GetInternKey(attr) };
+	const auto it = m_internedIds.constFind(key);
+	if (it != m_internedIds.constEnd()) {
+		return it.value();
+	}
+
+	if (!m_freeInterned.empty()) {
+		const uint32_t index{ m_freeInterned.back() };
+		m_freeInterned.pop_back();
+		m_interned[index] = attr;
+		m_internedIds.insert(key, InternedIdBase + index);
+		return InternedIdBase + index;
+	}
+
+	const uint32_t id{ InternedIdBase + static_cast<uint32_t>(m_interned.size()) };
+	if (id == InvalidId) {
+		return DefaultId;
+	}
+
+	m_interned.push_back(attr);
+	m_internedIds.insert(key, id);
+	return id;
+}
+
+void HighlightTable::ReleaseInterned(const std::vector<bool>& isUsed) noexcept
+{
+	auto used = [&](size_t index) noexcept {
+		return index < isUsed.size() && isUsed[index];
+	};
+
+	// Trailing styles are dropped, the others become free slots
+	size_t size{ m_interned.size() };
+	while (size > 0 && !used(size - 1)) {
+		size--;
+	}
+	m_interned.resize(size);
+
+	m_internedIds.clear();
+	m_freeInterned.clear();
+	for (size_t i=0; i<size; i++) {
+		if (used(i)) {
+			m_internedIds.insert(GetInternKey(m_interned[i]),
+				InternedIdBase + static_cast<uint32_t>(i));
+		} else {
+			m_interned[i] = {};
+			m_freeInterned.push_back(static_cast<uint32_t>(i));
+		}
+	}
+}
+
+const HighlightAttribute& HighlightTable::Get(uint32_t id) const noexcept
+{
+	static const HighlightAttribute defaultAttr;
+	static const HighlightAttribute invalidAttr{ Qt::white, Qt::red, QColor::Invalid,
+		false, false, false, false, false, false };
+
+	if (id == InvalidId) {
+		return invalidAttr;
+	}
+
+	if (id >= InternedIdBase) {
+		const uint32_t index{ id - InternedIdBase };
+		return (index < m_interned.size()) ? m_interned[index] : defaultAttr;
+	}
+
+	return (id < m_defined.size()) ? m_defined[id] : defaultAttr;
+}
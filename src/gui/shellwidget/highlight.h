@@ -1,7 +1,10 @@
 #pragma once
 
 #include <QColor>
+#include <QHash>
+#include <QPair>
 #include <QVariantMap>
+#include <vector>
 
 class HighlightAttribute {
 public:
@@ -54,6 +57,8 @@ public:
 	bool operator==(const HighlightAttribute& other) const noexcept;
 
 private:
+	friend class HighlightTable;
+
 	QColor m_foreground{ QColor::Invalid };
 	QColor m_background{ QColor::Invalid };
 	QColor m_special{ QColor::Invalid };
@@ -65,3 +70,56 @@ private:
 	bool m_undercurl{ false };
 	bool m_strikethrough{ false };
 };
+
+/// Highlight storage shared by the cells of a shell, cells only keep an id.
+///
+/// Ids below InternedIdBase are defined by Neovim through 'hl_attr_define',
+/// other styles (e.g. from the legacy 'highlight_set' event) are interned and
+/// get an id from the upper range.
+class HighlightTable {
+public:
+	/// Default highlight/style, also returned for unknown ids.
+	static constexpr uint32_t DefaultId{ 0 };
+
+	/// Style used to render ShellContents::invalidCell.
+	static constexpr uint32_t InvalidId{ 0xFFFFFFFF };
+
+	static constexpr uint32_t InternedIdBase{ 0x80000000 };
+
+	/// Store the attributes for a Neovim defined highlight id.
+	void Define(uint32_t id, const HighlightAttribute& attr) noexcept;
+
+	/// True if Neovim defined `id` through Define()
+	bool IsDefined(uint32_t id) const noexcept
+	{
+		return id < m_isDefined.size() && m_isDefined[id];
+	}
+
+	/// Returns an id for `attr`, identical attributes share the same id.
+	uint32_t Intern(const HighlightAttribute& attr) noexcept;
+
+	const HighlightAttribute& Get(uint32_t id) const noexcept;
+
+	/// Number of interned styles, released styles are not counted
+	int InternedCount() const noexcept
+	{
+		return static_cast<int>(m_interned.size() - m_freeInterned.size());
+	}
+
+	/// Release the interned styles not marked in `isUsed`, indexed by
+	/// id - InternedIdBase. Released ids are reused by Intern(), no cell may
+	/// still reference them.
+	void ReleaseInterned(const std::vector<bool>& isUsed) noexcept;
+
+private:
+	using InternKey = QPair<quint64, quint64>;
+	static InternKey GetInternKey(const HighlightAttribute& attr) noexcept;
+
+	std::vector<HighlightAttribute> m_defined;
+	std::vector<bool> m_isDefined;
+	std::vector<HighlightAttribute> m_interned;
+	QHash<InternKey, uint32_t> m_internedIds;
+
+	/// Released slots of m_interned
+	std::vector<uint32_t> m_freeInterned;
+};
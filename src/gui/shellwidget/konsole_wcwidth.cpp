@@ -68,6 +68,7 @@
 
 // Own
 #include "konsole_wcwidth.h"
+#include "konsole_wcwidth_table.h"
 
 struct interval {
     unsigned long first;
@@ -123,9 +124,13 @@ static int bisearch(unsigned long ucs, const struct interval* table, int max)
  *
  * This implementation assumes that quint16 characters are encoded
  * in ISO 10646.
+ *
+ * konsole_wcwidth() reads the same widths from the lookup table in
+ * konsole_wcwidth_table.h, generated from the tables below by
+ * generate_wcwidth_table.py. Run it again after changing the tables.
  */
 
-int konsole_wcwidth(uint ucs)
+int konsole_wcwidth_bisearch(uint ucs)
 {
     /* sorted list of non-overlapping intervals of non-spacing characters */
     /* generated by "uniset +cat=Me +cat=Mn +cat=Cf -00AD +1160-11FF +200B c" */
@@ -360,11 +365,31 @@ int konsole_wcwidth(uint ucs)
     return 1;
 }
 
+int konsole_wcwidth_lookup(uint ucs)
+{
+    /* code points beyond Unicode are not in any interval */
+    if (ucs > 0x10FFFF)
+        return 1;
+
+    const unsigned char* block = wcwidth_blocks[wcwidth_index[ucs >> wcwidth_block_shift]];
+    return ((block[(ucs & 0xFF) >> 2] >> ((ucs & 3) * 2)) & 3) - 1;
+}
+
 int string_width(const QString& text)
 {
     int w = 0;
-    for (int i = 0; i < text.length(); ++i)
-        w += konsole_wcwidth(text[i].unicode());
+    const int length = text.length();
+    for (int i = 0; i < length; ++i) {
+        uint ucs = text[i].unicode();
+
+        /* characters outside the BMP are a surrogate pair */
+        if (QChar::isHighSurrogate(ucs) && i + 1 < length
+                && text[i + 1].isLowSurrogate()) {
+            ucs = QChar::surrogateToUcs4(ucs, text[i + 1].unicode());
+            ++i;
+        }
+        w += konsole_wcwidth(ucs);
+    }
     return w;
 }
 
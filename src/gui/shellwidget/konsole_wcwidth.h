@@ -9,7 +9,21 @@
 // Qt
 #include <QtCore/QString>
 
-int konsole_wcwidth(uint ucs);
+/* Width from the interval tables, the reference for konsole_wcwidth_lookup() */
+int konsole_wcwidth_bisearch(uint ucs);
+
+/* Width from the generated table in konsole_wcwidth_table.h */
+int konsole_wcwidth_lookup(uint ucs);
+
+/* Column width of a code point: 0 for combining characters, 2 for wide
+ * characters and -1 for control characters. */
+inline int konsole_wcwidth(uint ucs)
+{
+    /* printable ASCII, most characters in a shell */
+    if (ucs - 0x20 < 0x5f)
+        return 1;
+    return konsole_wcwidth_lookup(ucs);
+}
 
 int string_width(const QString& text);
 
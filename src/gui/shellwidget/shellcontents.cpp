@@ -1,5 +1,7 @@
 #include <QFile>
+#include <QTextBoundaryFinder>
 #include <QDebug>
+#include <algorithm>
 #include "shellcontents.h"
 #include "konsole_wcwidth.h"
 
@@ -33,6 +35,16 @@ bool ShellContents::fromFile(const QString& path)
 
 ShellContents::ShellContents(int rows, int columns)
 :_data(0), _rows(rows), _columns(columns)
+,m_highlights(std::make_shared<HighlightTable>())
+,m_clusters(std::make_shared<ClusterTable>())
+{
+	allocData();
+}
+
+ShellContents::ShellContents(int rows, int columns, const ShellContents& other)
+:_data(0), _rows(rows), _columns(columns)
+,m_highlights(other.m_highlights)
+,m_clusters(other.m_clusters)
 {
 	allocData();
 }
@@ -46,42 +58,121 @@ ShellContents::~ShellContents()
 
 ShellContents::ShellContents(const ShellContents& other)
 :_data(0), _rows(other._rows), _columns(other._columns)
+,m_highlights(other.m_highlights)
+,m_clusters(other.m_clusters)
 {
 	if (other._data != NULL) {
 		allocData();
-		memcpy(_data, other._data, _rows*_columns);
+		for (int i=0; i<_rows; i++) {
+			memcpy(m_lines[i], other.m_lines[i], _columns*sizeof(Cell));
+		}
 	}
 }
 
-/// Allocates new shell data storage.
+/// Fill `count` cells with `cell`, nothing for counts below 1. Cells are stored
+/// as 64 bit words, a loop the compiler turns into vector stores.
+static void FillCells(Cell* dst, int count, const Cell& cell) noexcept
+{
+	static_assert(sizeof(Cell) == sizeof(uint64_t), "Cells are filled as 64 bit words");
+
+	uint64_t word;
+	memcpy(&word, &cell, sizeof(word));
+
+	unsigned char* out{ reinterpret_cast<unsigned char*>(dst) };
+	for (int i=0; i<count; i++) {
+		memcpy(out + i*sizeof(word), &word, sizeof(word));
+	}
+}
+
+/// Allocates new shell data storage, rows are stored in order.
 /// This leaks memory, make sure to free _data if
 /// needed.
 void ShellContents::allocData()
 {
 	_data = new Cell[_rows*_columns];
+	m_lines.resize(_rows);
+	for (int i=0; i<_rows; i++) {
+		m_lines[i] = &_data[i*_columns];
+	}
 }
 
-void ShellContents::clearAll(QColor bg)
+/// Fill a range of rows with `cell`
+void ShellContents::fillRows(int row0, int row1, const Cell& cell) noexcept
 {
-	for (int i=0; i<_rows; i++) {
-		for (int j=0; j<_columns; j++) {
-			_data[i*_columns+j] = Cell{ bg };
+	// All rows are a single block of _data, whatever their order
+	if (row0 == 0 && row1 == _rows) {
+		FillCells(_data, _rows*_columns, cell);
+		return;
+	}
+
+	for (int i=row0; i<row1; i++) {
+		FillCells(m_lines[i], _columns, cell);
+	}
+}
+
+const Cell& ShellContents::blankCell(const QColor& bg) noexcept
+{
+	if (bg != m_blankBackground) {
+		const uint32_t hl_id{ m_highlights->Intern({ QColor::Invalid, bg, QColor::Invalid,
+			false, false, false, false, false, false }) };
+		m_blankBackground = bg;
+		m_blankCell = Cell::MakeBlankCell(hl_id);
+	}
+	return m_blankCell;
+}
+
+static void MarkUsed(ShellContents::Usage& usage, const Cell& cell) noexcept
+{
+	if (cell.IsCluster()) {
+		const size_t id{ cell.GetClusterId() };
+		if (id >= usage.clusters.size()) {
+			usage.clusters.resize(id + 1);
 		}
+		usage.clusters[id] = true;
+	}
+
+	const uint32_t hl_id{ cell.GetHighlightId() };
+	if (hl_id < HighlightTable::InternedIdBase || hl_id == HighlightTable::InvalidId) {
+		return;
+	}
+
+	const size_t index{ hl_id - HighlightTable::InternedIdBase };
+	if (index >= usage.highlights.size()) {
+		usage.highlights.resize(index + 1);
 	}
+	usage.highlights[index] = true;
+}
+
+void ShellContents::markUsed(Usage& usage) const noexcept
+{
+	const Cell* const end{ _data + _rows*_columns };
+	for (const Cell* cell=_data; cell != end; cell++) {
+		MarkUsed(usage, *cell);
+	}
+
+	// Cached by blankCell()
+	MarkUsed(usage, m_blankCell);
+}
+
+void ShellContents::releaseUnused(const Usage& usage) noexcept
+{
+	m_highlights->ReleaseInterned(usage.highlights);
+	m_clusters->Release(usage.clusters);
+}
+
+void ShellContents::clearAll(QColor bg)
+{
+	fillRows(0, _rows, blankCell(bg));
 }
 
 void ShellContents::clearRow(int r, int startCol)
 {
 	if (r < 0 || r >= _rows || startCol < 0 ||
-			startCol > _rows) {
+			startCol > _columns) {
 		return;
 	}
 
-	int start = r*_columns + startCol;
-	int end = start + _columns;
-	for (int i=start; i<end-startCol; i++) {
-		_data[i] = Cell();
-	}
+	FillCells(m_lines[r] + startCol, _columns - startCol, Cell());
 }
 
 
@@ -116,15 +207,17 @@ void ShellContents::clearRegion(int row0, int col0, int row1, int col1,
 		return;
 	}
 
+	const Cell& empty{ blankCell(bg) };
 	for (int i=row0; i<row1; i++) {
-		for (int j=col0; j<col1; j++) {
-			_data[i*_columns + j] = Cell{ bg };
-		}
+		FillCells(m_lines[i] + col0, col1 - col0, empty);
 	}
 }
 
 /// Scroll the region by count lines. (row1, col1) is the first position outside
 /// the scrolled area.
+///
+/// Full width regions rotate the row pointers and only clear the rows scrolled
+/// into the region, other regions are copied cell by cell.
 void ShellContents::scrollRegion(int row0, int row1, int col0, int col1, int count)
 {
 	if (count == 0) {
@@ -136,6 +229,23 @@ void ShellContents::scrollRegion(int row0, int row1, int col0, int col1, int cou
 		return;
 	}
 
+	if (col0 == 0 && col1 == _columns) {
+		if (qAbs(count) >= row1 - row0) {
+			fillRows(row0, row1, Cell());
+		}
+		else if (count > 0) {
+			std::rotate(m_lines.begin() + row0, m_lines.begin() + row0 + count,
+				m_lines.begin() + row1);
+			fillRows(row1 - count, row1, Cell());
+		}
+		else {
+			std::rotate(m_lines.begin() + row0, m_lines.begin() + row1 + count,
+				m_lines.begin() + row1);
+			fillRows(row0, row0 - count, Cell());
+		}
+		return;
+	}
+
 	int start, stop, inc;
 	if (count > 0) {
 		start = row0;
@@ -151,15 +261,12 @@ void ShellContents::scrollRegion(int row0, int row1, int col0, int col1, int cou
 		int dst = i-count;
 		if (dst >= row0 && dst < row1) {
 			// Copy line
-			memcpy(&_data[dst*_columns + col0],
-				&_data[i*_columns + col0],
+			memcpy(m_lines[dst] + col0, m_lines[i] + col0,
 				(col1-col0)*sizeof(Cell));
 		}
 
 		// Clear src line
-		for (int j=col0; j<col1; j++) {
-			new (&_data[i*_columns + j]) Cell();
-		}
+		FillCells(m_lines[i] + col0, col1 - col0, Cell());
 	}
 }
 
@@ -168,6 +275,25 @@ void ShellContents::scroll(int count)
 	scrollRegion(0, _rows, 0, _columns, count);
 }
 
+void ShellContents::copyRegion(const ShellContents& source, int srcRow, int srcColumn,
+		int row, int column, int rowcount, int colcount) noexcept
+{
+	// Clip the area to the source, then to this grid
+	const int top{ qMax(qMax(-srcRow, -row), 0) };
+	const int left{ qMax(qMax(-srcColumn, -column), 0) };
+	rowcount = qMin(qMin(rowcount, source._rows - srcRow), _rows - row);
+	colcount = qMin(qMin(colcount, source._columns - srcColumn), _columns - column);
+	if (top >= rowcount || left >= colcount) {
+		return;
+	}
+
+	for (int i=top; i<rowcount; i++) {
+		memcpy(m_lines[row + i] + column + left,
+			source.m_lines[srcRow + i] + srcColumn + left,
+			(colcount - left)*sizeof(Cell));
+	}
+}
+
 void ShellContents::resize(int newRows, int newColumns)
 {
 	if (newRows <= 0 || newColumns <= 0) {
@@ -180,6 +306,8 @@ void ShellContents::resize(int newRows, int newColumns)
 	}
 
 	Cell *old = _data;
+	std::vector<Cell*> oldLines;
+	oldLines.swap(m_lines);
 	int oldRows = _rows;
 	int oldColumns = _columns;
 
@@ -192,32 +320,25 @@ void ShellContents::resize(int newRows, int newColumns)
 	int copyColumns = qMin(oldColumns, _columns);
 
 	for (int i=0; i<copyRows; i++) {
-		memcpy(&_data[i*_columns],
-			&old[i*oldColumns],
-			copyColumns*sizeof(Cell));
+		memcpy(m_lines[i], oldLines[i], copyColumns*sizeof(Cell));
 	}
 
 	delete [] old;
 }
 
-const Cell* ShellContents::data()
-{
-	return _data;
-}
-
 Cell& ShellContents::value(int row, int column)
 {
 	if (row < 0 || row >= _rows || column < 0 || column >= _columns) {
 		return invalidCell;
 	}
-	return _data[row*_columns + column];
+	return m_lines[row][column];
 }
 const Cell& ShellContents::constValue(int row, int column) const
 {
 	if (row < 0 || row >= _rows || column < 0 || column >= _columns) {
 		return invalidCell;
 	}
-	return _data[row*_columns + column];
+	return m_lines[row][column];
 }
 
 /// Writes content to the shell, returns the number of columns written
@@ -231,12 +352,24 @@ int ShellContents::put(
 		return 0;
 	}
 
-	const QVector<uint> vec{ str.toUcs4() };
+	const uint32_t hl_id{ m_highlights->Intern(hl_attr) };
 
+	QTextBoundaryFinder finder{ QTextBoundaryFinder::Grapheme, str };
+	int start = 0;
 	int pos = column;
-	for(const uint chr : vec) {
+	while (finder.toNextBoundary() != -1) {
+		const int end{ finder.position() };
+		const QString grapheme{ str.mid(start, end - start) };
+		start = end;
+
 		Cell& cell{ value(row, pos) };
-		cell = { chr, hl_attr };
+		const QVector<uint> characters{ grapheme.toUcs4() };
+		if (characters.size() == 1) {
+			cell = { characters[0], hl_id };
+		} else {
+			const QByteArray utf8{ grapheme.toUtf8() };
+			cell = clusterCell(utf8.constData(), utf8.size(), characters.value(0), hl_id);
+		}
 		pos++;
 
 		// Clear neighboring character for double-width cell.
@@ -247,3 +380,116 @@ int ShellContents::put(
 	}
 	return pos - column;
 }
+
+/// Decode the first code point of a UTF-8 string, malformed input decodes
+/// as U+FFFD. Sets `length` to the number of bytes used, the whole string
+/// for malformed input.
+static uint DecodeFirstCodePoint(const char* text, int size, int& length) noexcept
+{
+	static constexpr uint replacement{ 0xFFFD };
+	static constexpr uint minimum[]{ 0, 0, 0x80, 0x800, 0x10000 };
+
+	const unsigned char* s{ reinterpret_cast<const unsigned char*>(text) };
+	const uint lead{ s[0] };
+	if (lead < 0x80) {
+		length = 1;
+		return lead;
+	}
+
+	length = size;
+
+	int len;
+	uint codepoint;
+	if ((lead & 0xE0) == 0xC0) {
+		len = 2;
+		codepoint = lead & 0x1F;
+	} else if ((lead & 0xF0) == 0xE0) {
+		len = 3;
+		codepoint = lead & 0x0F;
+	} else if ((lead & 0xF8) == 0xF0) {
+		len = 4;
+		codepoint = lead & 0x07;
+	} else {
+		return replacement;
+	}
+
+	if (size < len) {
+		return replacement;
+	}
+
+	for (int i=1; i<len; i++) {
+		if ((s[i] & 0xC0) != 0x80) {
+			return replacement;
+		}
+		codepoint = (codepoint << 6) | (s[i] & 0x3F);
+	}
+
+	// Overlong encodings, surrogates and values outside of Unicode
+	if (codepoint < minimum[len] || codepoint > 0x10FFFF
+		|| (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+		return replacement;
+	}
+
+	length = len;
+	return codepoint;
+}
+
+Cell ShellContents::clusterCell(
+	const char* text,
+	int size,
+	uint first,
+	uint32_t hl_id) noexcept
+{
+	const uint32_t id{ m_clusters->Intern(text, size) };
+	if (id == ClusterTable::InvalidId) {
+		return { first, hl_id };
+	}
+	return Cell::MakeClusterCell(id, m_clusters->IsDoubleWidth(id), hl_id);
+}
+
+/// Writes a line of cells to the shell, returns the number of columns written.
+///
+/// Cells with a single code point are stored inline, longer grapheme clusters
+/// are interned. Empty cells are the right half of a double-width character
+/// and are skipped.
+int ShellContents::putLine(
+	int row,
+	int column,
+	const LineCell* cells,
+	int count) noexcept
+{
+	if (row < 0 || row >= _rows || column < 0 || column >= _columns) {
+		return 0;
+	}
+
+	Cell* line{ m_lines[row] };
+	int pos = column;
+	int end = column;
+	for (int i=0; i<count && pos < _columns; i++) {
+		const LineCell& lineCell{ cells[i] };
+
+		if (lineCell.size <= 0) {
+			pos += lineCell.repeat;
+			continue;
+		}
+
+		int length;
+		const uint character{ DecodeFirstCodePoint(lineCell.text, lineCell.size, length) };
+		const Cell cell{ (length < lineCell.size)
+			? clusterCell(lineCell.text, lineCell.size, character, lineCell.hl_id)
+			: Cell{ character, lineCell.hl_id } };
+		for (int j=0; j<lineCell.repeat && pos < _columns; j++) {
+			line[pos] = cell;
+			pos++;
+
+			// Clear neighboring character for double-width cell.
+			if (cell.IsDoubleWidth() && pos < _columns) {
+				line[pos] = {};
+				end = qMax(end, pos + 1);
+			}
+		}
+		end = qMax(end, pos);
+	}
+
+	return end - column;
+}
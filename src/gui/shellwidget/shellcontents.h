@@ -1,6 +1,24 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "cell.h"
+#include "clustertable.h"
+
+/// A run of identical cells for ShellContents::putLine(). The text is a single
+/// UTF-8 encoded grid cell, and is not copied.
+struct LineCell
+{
+	const char* text;
+	int size;
+
+	/// Cell style, an id from the HighlightTable of the ShellContents
+	uint32_t hl_id;
+
+	/// Number of consecutive columns filled with this cell
+	int repeat;
+};
 
 /// A class to hold the contents of the shell / i.e. a grid of characters. This
 /// class is meant to hold state about shell contents, but no more - e.g. cursor
@@ -9,6 +27,9 @@ class ShellContents
 {
 public:
 	ShellContents(int rows, int columns);
+
+	/// Empty contents sharing the styles of `other`, e.g. for the grids of a shell
+	ShellContents(int rows, int columns, const ShellContents& other);
 	~ShellContents();
 	ShellContents(const ShellContents& other);
 
@@ -21,17 +42,57 @@ public:
 
 	bool fromFile(const QString& path);
 
-	const Cell* data();
 	Cell& value(int row, int column);
 	const Cell& constValue(int row, int column) const;
 
-	/// Insert string `str` into cell grid.
+	/// Styles referenced by the cells, shared with copies of this object
+	HighlightTable& highlights() noexcept { return *m_highlights; }
+	const HighlightTable& highlights() const noexcept { return *m_highlights; }
+
+	/// Lookup the style of a cell
+	const HighlightAttribute& highlight(const Cell& cell) const noexcept
+	{
+		return m_highlights->Get(cell.GetHighlightId());
+	}
+
+	/// Grapheme clusters used by the cells, shared with copies of this object
+	const ClusterTable& clusters() const noexcept { return *m_clusters; }
+
+	/// The text shown by a cell, a single code point or a grapheme cluster
+	QString text(const Cell& cell) const noexcept
+	{
+		if (cell.IsCluster()) {
+			return m_clusters->GetText(cell.GetClusterId());
+		}
+		const uint character{ cell.GetCharacter() };
+		return QString::fromUcs4(&character, 1);
+	}
+
+	/// The first code point of a cell, e.g. to choose a font
+	uint baseCharacter(const Cell& cell) const noexcept
+	{
+		if (cell.IsCluster()) {
+			return m_clusters->GetFirstCharacter(cell.GetClusterId());
+		}
+		return cell.GetCharacter();
+	}
+
+	/// Insert string `str` into cell grid, one grapheme cluster per cell.
 	int put(
 		const QString& str,
 		int row,
 		int column,
 		const HighlightAttribute& hl_attr = {}) noexcept;
 
+	/// Insert a line of UTF-8 cells into the grid, one column per cell and
+	/// repeat. Cells holding more than one code point are stored as grapheme
+	/// clusters. Returns the number of columns changed starting at `column`.
+	int putLine(
+		int row,
+		int column,
+		const LineCell* cells,
+		int count) noexcept;
+
 	void clearAll(QColor bg=QColor());
 	void clearRow(int r, int startCol=0);
 	void clearRegion(int row0, int col0, int row1, int col1,
@@ -40,14 +101,54 @@ public:
 	void scrollRegion(int row0, int row1, int col0, int col1, int count);
 	void scroll(int rows);
 
+	/// Copy an area of `source` starting at (srcRow, srcColumn) to (row, column),
+	/// the area is clipped to both grids. Both grids must share their styles.
+	void copyRegion(const ShellContents& source, int srcRow, int srcColumn,
+			int row, int column, int rowcount, int colcount) noexcept;
+
+	/// Interned styles and clusters referenced by cells, see markUsed()
+	struct Usage
+	{
+		/// Indexed by id - HighlightTable::InternedIdBase
+		std::vector<bool> highlights;
+
+		/// Indexed by cluster id
+		std::vector<bool> clusters;
+	};
+
+	/// Mark the interned styles and clusters used by the cells. The tables are
+	/// shared, so every contents sharing them must be marked before
+	/// releaseUnused().
+	void markUsed(Usage& usage) const noexcept;
+
+	/// Release the interned styles and clusters not marked in `usage`
+	void releaseUnused(const Usage& usage) noexcept;
+
 private:
 	void allocData();
+	void fillRows(int row0, int row1, const Cell& cell) noexcept;
+
+	/// Cell for the grapheme cluster `text`, a cell holding the first code
+	/// point if the cluster table is full.
+	Cell clusterCell(const char* text, int size, uint first, uint32_t hl_id) noexcept;
+
+	/// Blank cell used to clear with background `bg`
+	const Cell& blankCell(const QColor& bg) noexcept;
 	bool verifyRegion(int& row0, int& row1, int& col0, int& col1);
 
 	// row*columns
 	Cell *_data;
+
+	/// Start of each row in _data, full width scrolls reorder the rows
+	std::vector<Cell*> m_lines;
 	static Cell invalidCell;
 	int _rows, _columns;
+	std::shared_ptr<HighlightTable> m_highlights;
+	std::shared_ptr<ClusterTable> m_clusters;
+
+	/// Blank cell for the last background passed to blankCell()
+	QColor m_blankBackground;
+	Cell m_blankCell;
 
 	ShellContents& operator=(const ShellContents& other);
 };
@@ -6,6 +6,10 @@
 #include <QPaintEvent>
 #include <QTextLayout>
 #include <QtMath>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
 
 #include "compat.h"
 #include "compat_shellwidget.h"
@@ -19,6 +23,18 @@ constexpr int c_qtWeightMin{ 1 };
 constexpr int c_qtWeightMax{ 1000 };
 #endif
 
+/// Number of bold/italic combinations for each font in the cell font table
+constexpr uint32_t c_fontVariantCount{ 4 };
+
+/// Frames are flushed after this delay if flushFrame() is never called
+constexpr int c_frameFlushTimeoutMs{ 20 };
+
+/// Interned styles and clusters are not released until there are at least
+/// this many
+constexpr int c_internedLimitMin{ 4096 };
+
+/*static*/ constexpr uint64_t ShellWidget::DefaultGridId;
+
 ShellWidget::ShellWidget(QWidget* parent)
 	: QWidget(parent)
 {
@@ -33,6 +49,10 @@ ShellWidget::ShellWidget(QWidget* parent)
 
 	// Blinking Cursor Timer
 	connect(&m_cursor, &Cursor::CursorChanged, this, &ShellWidget::handleCursorChanged);
+
+	m_frameTimer.setSingleShot(true);
+	m_frameTimer.setInterval(c_frameFlushTimeoutMs);
+	connect(&m_frameTimer, &QTimer::timeout, this, &ShellWidget::flushFrame);
 }
 
 ShellWidget* ShellWidget::fromFile(const QString& path)
@@ -46,6 +66,7 @@ void ShellWidget::setDefaultFont()
 {
 	static const QFont font{ getDefaultFontFamily(), 11 /*pointSize*/, -1 /*weight*/, false /*italic*/ };
 	setFont(font);
+	updateCellFonts();
 	setCellSize();
 }
 
@@ -88,6 +109,7 @@ bool ShellWidget::setShellFont(const QFont& font, bool force) noexcept
 	}
 
 	setFont(font);
+	updateCellFonts();
 	setCellSize();
 	emit shellFontChanged();
 	return true;
@@ -120,6 +142,11 @@ void ShellWidget::setCellSize()
 	m_cellSize = QSize(GetHorizontalAdvance(fm, 'W'),
 			qMax(fm.lineSpacing(), fm.height()) + m_lineSpace);
 	setSizeIncrement(m_cellSize);
+
+	// Cached glyphs depend on the font and cell size
+	m_glyphCache.Clear();
+	m_glyphRunCache.Clear();
+	updateAll();
 }
 QSize ShellWidget::cellSize() const
 {
@@ -251,7 +278,8 @@ void ShellWidget::paintUnderline(
 	const Cell& cell,
 	QRect cellRect) noexcept
 {
-	if (!cell.IsUnderline()) {
+	const HighlightAttribute& hl{ m_contents.highlight(cell) };
+	if (!hl.IsUnderline()) {
 		return;
 	}
 
@@ -287,7 +315,8 @@ void ShellWidget::paintUndercurl(
 	const Cell& cell,
 	QRect cellRect) noexcept
 {
-	if (!cell.IsUndercurl()) {
+	const HighlightAttribute& hl{ m_contents.highlight(cell) };
+	if (!hl.IsUndercurl()) {
 		return;
 	}
 
@@ -318,7 +347,8 @@ void ShellWidget::paintStrikeThrough(
 	const Cell& cell,
 	QRect cellRect) noexcept
 {
-	if (!cell.IsStrikeThrough()) {
+	const HighlightAttribute& hl{ m_contents.highlight(cell) };
+	if (!hl.IsStrikeThrough()) {
 		return;
 	}
 
@@ -332,9 +362,10 @@ void ShellWidget::paintBackgroundClearCell(
 	QRect cellRect,
 	bool isCursorCell) noexcept
 {
-	QColor bgColor{ cell.GetBackgroundColor() };
+	const HighlightAttribute& hl{ m_contents.highlight(cell) };
+	QColor bgColor{ hl.GetBackgroundColor() };
 	if (!bgColor.isValid()) {
-		bgColor = (cell.IsReverse()) ? foreground() : background();
+		bgColor = (hl.IsReverse()) ? foreground() : background();
 	}
 
 	p.fillRect(cellRect, bgColor);
@@ -345,49 +376,182 @@ void ShellWidget::paintBackgroundClearCell(
 	}
 }
 
-QFont ShellWidget::GetCellFont(const Cell& cell) const noexcept
+/// True if text drawn on an opaque image uses subpixel antialiasing, i.e.
+/// glyphs are drawn with color fringes.
+static bool IsSubpixelAntialiased(const QFont& font) noexcept
 {
-	QFont cellFont{ font() };
+	const QFontMetrics fm{ font };
+	QImage image{ QSize{ fm.height() * 2, fm.height() }, QImage::Format_RGB32 };
+	image.fill(Qt::white);
 
-	if (cell.IsDoubleWidth()) {
+	QPainter p{ &image };
+	p.setPen(Qt::black);
+	p.setFont(font);
+	p.drawText(QPoint{ 1, fm.ascent() }, QStringLiteral("Wm"));
+	p.end();
 
-		auto isCharacterInWideFont = [&](const QFont& wideFont) noexcept
-		{
-			return QFontMetrics(wideFont).inFontUcs4(cell.GetCharacter());
-		};
+	for (int y=0; y<image.height(); y++) {
+		const QRgb* line{ reinterpret_cast<const QRgb*>(image.constScanLine(y)) };
+		for (int x=0; x<image.width(); x++) {
+			if (qRed(line[x]) != qGreen(line[x]) || qGreen(line[x]) != qBlue(line[x])) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
 
-		auto wideFont = std::find_if(m_guifontwidelist.begin(), m_guifontwidelist.end(), isCharacterInWideFont);
+void ShellWidget::updateCellFonts() noexcept
+{
+	m_cellFonts.clear();
+	m_wideFontMetrics.clear();
+	m_wideFontIndex.clear();
 
-		if (wideFont != m_guifontwidelist.end())
-		{
-			cellFont = *wideFont;
+	auto addFontVariants = [&](const QFont& baseFont) noexcept
+	{
+		for (uint32_t variant=0; variant<c_fontVariantCount; variant++) {
+			QFont cellFont{ baseFont };
+
+			if (variant & GlyphCache::Bold) {
+				cellFont.setBold(true);
+			}
+
+			if (variant & GlyphCache::Italic) {
+				cellFont.setItalic(true);
+			}
+
+			// Issue #575: Clear style name. The KDE/Plasma theme plugin may set this
+			// but we want to match the family name with the bold/italic attributes.
+			cellFont.setStyleName({});
+
+			cellFont.setStyleHint(QFont::TypeWriter, fontStyleStrategy());
+			cellFont.setFixedPitch(true);
+			cellFont.setKerning(false);
+
+			m_cellFonts.push_back(cellFont);
+		}
+	};
+
+	addFontVariants(font());
+	for (const QFont& wideFont : m_guifontwidelist) {
+		addFontVariants(wideFont);
+		m_wideFontMetrics.emplace_back(wideFont);
+	}
+
+	m_isSubpixelAntialiased = IsSubpixelAntialiased(m_cellFonts[0]);
+	m_glyphCache.Clear();
+	m_glyphRunCache.Clear();
+	updateAll();
+}
+
+const QFont& ShellWidget::GetCellFont(const Cell& cell) const noexcept
+{
+	if (m_cellFonts.empty()) {
+		return font();
+	}
+
+	return m_cellFonts[GetCellFontIndex(cell)];
+}
+
+int ShellWidget::GetCellFontIndex(const Cell& cell) const noexcept
+{
+	const uint32_t variant{
+		GetCellFontVariant(cell) & (GlyphCache::Bold | GlyphCache::Italic) };
+	const int fontIndex{ (cell.IsDoubleWidth())
+		? GetWideFontIndex(m_contents.baseCharacter(cell)) : 0 };
+
+	return fontIndex * c_fontVariantCount + variant;
+}
+
+int ShellWidget::GetWideFontIndex(uint character) const noexcept
+{
+	const auto cached = m_wideFontIndex.constFind(character);
+	if (cached != m_wideFontIndex.constEnd()) {
+		return *cached;
+	}
+
+	int fontIndex{ 0 };
+	for (size_t i=0; i<m_wideFontMetrics.size(); i++) {
+		if (m_wideFontMetrics[i].inFontUcs4(character)) {
+			fontIndex = static_cast<int>(i) + 1;
+			break;
 		}
 	}
 
-	if (cell.IsBold() && renderFontAttr()) {
-		cellFont.setBold(cell.IsBold());
+	m_wideFontIndex.insert(character, fontIndex);
+	return fontIndex;
+}
+
+/// The font style bits used by GetCellFont, see GlyphCache::Variant
+uint32_t ShellWidget::GetCellFontVariant(const Cell& cell) const noexcept
+{
+	const HighlightAttribute& hl{ m_contents.highlight(cell) };
+	uint32_t variant{ GlyphCache::Regular };
+
+	if (hl.IsBold() && renderFontAttr()) {
+		variant |= GlyphCache::Bold;
+	}
+
+	if (hl.IsItalic() && renderFontAttr()) {
+		variant |= GlyphCache::Italic;
 	}
 
-	if (cell.IsItalic() && renderFontAttr()) {
-		cellFont.setItalic(cell.IsItalic());
+	if (cell.IsDoubleWidth()) {
+		variant |= GlyphCache::DoubleWidth;
+	}
+
+	return variant;
+}
+
+QImage ShellWidget::GetCellGlyph(
+	const Cell& cell,
+	const QColor& fgColor,
+	qreal devicePixelRatio) noexcept
+{
+	m_glyphCache.SetDevicePixelRatio(devicePixelRatio);
+
+	// Cluster ids share the code point bits, keep them apart in the cache key
+	const uint32_t variant{ GetCellFontVariant(cell)
+		| (cell.IsCluster() ? GlyphCache::Cluster : GlyphCache::Regular) };
+	const quint64 key{ GlyphCache::GetKey(cell.GetCharacter(), variant, fgColor.rgba()) };
+
+	QImage glyph{ m_glyphCache.Find(key) };
+	if (!glyph.isNull()) {
+		return glyph;
 	}
 
-	// Issue #575: Clear style name. The KDE/Plasma theme plugin may set this
-	// but we want to match the family name with the bold/italic attributes.
-	cellFont.setStyleName({});
+	// Glyphs may overflow into the next cell, see paintRectNoLigatures. A cell
+	// of padding on the left keeps ink at negative x, e.g. italic bearings.
+	const int chars{ cell.IsDoubleWidth() ? 4 : 3 };
+	const QSize glyphSize{ m_cellSize.width() * chars, m_cellSize.height() };
+
+	glyph = QImage{ glyphSize * devicePixelRatio, QImage::Format_ARGB32_Premultiplied };
+	glyph.setDevicePixelRatio(devicePixelRatio);
+	glyph.fill(Qt::transparent);
+
+	// Point size fonts are scaled by the image DPI, match the widget metrics
+	glyph.setDotsPerMeterX(qRound(logicalDpiX() / 0.0254));
+	glyph.setDotsPerMeterY(qRound(logicalDpiY() / 0.0254));
+
+	QPainter p{ &glyph };
+	p.setPen(fgColor);
+	p.setFont(GetCellFont(cell));
 
-	cellFont.setStyleHint(QFont::TypeWriter, fontStyleStrategy());
-	cellFont.setFixedPitch(true);
-	cellFont.setKerning(false);
+	// Draw chars at the baseline
+	const int cellTextOffset{ m_ascent + (m_lineSpace / 2) };
+	p.drawText(QPoint{ m_cellSize.width(), cellTextOffset }, m_contents.text(cell));
+	p.end();
 
-	return cellFont;
+	m_glyphCache.Insert(key, glyph);
+	return glyph;
 }
 
 QPen ShellWidget::getForegroundPen(const Cell& cell) noexcept
 {
+	const HighlightAttribute& hl{ m_contents.highlight(cell) };
 	QPen pen;
-	if (cell.GetForegroundColor().isValid()) {
-		pen.setColor(cell.GetForegroundColor());
+	if (hl.GetForegroundColor().isValid()) {
+		pen.setColor(hl.GetForegroundColor());
 	} else {
 		pen.setColor(foreground());
 	}
@@ -397,11 +561,12 @@ QPen ShellWidget::getForegroundPen(const Cell& cell) noexcept
 
 QPen ShellWidget::getSpecialPen(const Cell& cell) noexcept
 {
+	const HighlightAttribute& hl{ m_contents.highlight(cell) };
 	QPen pen;
-	if (cell.GetSpecialColor().isValid()) {
-		pen.setColor(cell.GetSpecialColor());
-	} else if (cell.GetForegroundColor().isValid()) {
-		pen.setColor(cell.GetForegroundColor());
+	if (hl.GetSpecialColor().isValid()) {
+		pen.setColor(hl.GetSpecialColor());
+	} else if (hl.GetForegroundColor().isValid()) {
+		pen.setColor(hl.GetForegroundColor());
 	} else {
 		pen.setColor(foreground());
 	}
@@ -417,27 +582,36 @@ void ShellWidget::paintForegroundCellText(
 	QRect cellRect,
 	bool isCursorCell) noexcept
 {
-	if (cell.GetCharacter() == ' ') {
+	if (!cell.IsCluster() && cell.GetCharacter() == ' ') {
 		return;
 	}
 
-	QColor fgColor{ cell.GetForegroundColor() };
+	const HighlightAttribute& hl{ m_contents.highlight(cell) };
+	QColor fgColor{ hl.GetForegroundColor() };
 	if (!fgColor.isValid()) {
-		fgColor = (cell.IsReverse()) ? background() : foreground();
+		fgColor = (hl.IsReverse()) ? background() : foreground();
 	}
-	p.setPen(fgColor);
-	p.setFont(GetCellFont(cell));
 
 	// Draw chars at the baseline
 	const int cellTextOffset{ m_ascent + (m_lineSpace / 2) };
 	const QPoint pos{ cellRect.left(), cellRect.top() + cellTextOffset};
-	const uint character{ cell.GetCharacter() };
-	const QString text{ QString::fromUcs4(&character, 1) };
 
-	p.drawText(pos, text);
+	// Cached glyphs are rasterized over a transparent background, which
+	// disables subpixel antialiasing. Draw the text directly when it is used.
+	if (m_isSubpixelAntialiased) {
+		p.setPen(fgColor);
+		p.setFont(GetCellFont(cell));
+		p.drawText(pos, m_contents.text(cell));
+	}
+	else {
+		// Glyph images have one cell of padding on the left, see GetCellGlyph
+		p.drawImage(cellRect.topLeft() - QPoint{ m_cellSize.width(), 0 },
+			GetCellGlyph(cell, fgColor, p.device()->devicePixelRatioF()));
+	}
 
 	if (isCursorCell) {
-		paintNeovimCursorForeground(p, cellRect, pos, text);
+		p.setFont(GetCellFont(cell));
+		paintNeovimCursorForeground(p, cellRect, pos, m_contents.text(cell));
 	}
 }
 
@@ -514,43 +688,35 @@ static QVector<uint32_t> RemoveLigaturesUnderCursor(
 	return {};
 }
 
-void ShellWidget::paintForegroundTextBlock(
-	QPainter& p,
+QList<QGlyphRun> ShellWidget::GetTextBlockGlyphRuns(
 	const Cell& cell,
-	QRect blockRect,
 	const QString& text,
-	int cursorPos) noexcept
+	QPaintDevice* device) noexcept
 {
-	QColor fgColor{ cell.GetForegroundColor() };
-	if (!fgColor.isValid()) {
-		fgColor = (cell.IsReverse()) ? background() : foreground();
-	}
+	const int cellWidth{ (cell.IsDoubleWidth()) ?
+		m_cellSize.width() * 2 : m_cellSize.width() };
 
-	const QFont blockFont{ GetCellFont(cell) };
+	const GlyphRunCache::Key key{
+		GlyphRunCache::GetKey(text, GetCellFontIndex(cell), cellWidth) };
 
-	p.setPen(fgColor);
-	p.setFont(blockFont);
-
-	const int cellTextOffset{ m_lineSpace / 2 };
-	const QPoint pos{ blockRect.left(), blockRect.top() + cellTextOffset };
+	const QList<QGlyphRun>* cachedGlyphRuns{ m_glyphRunCache.Find(key) };
+	if (cachedGlyphRuns) {
+		return *cachedGlyphRuns;
+	}
 
-	QTextLayout textLayout{ text, blockFont, p.device() };
+	QTextLayout textLayout{ text, GetCellFont(cell), device };
 	textLayout.setCacheEnabled(true);
 	textLayout.beginLayout();
 	QTextLine line = textLayout.createLine();
 	if (!line.isValid()) {
-		return;
+		return {};
 	}
 	line.setNumColumns(text.length());
 	textLayout.endLayout();
 
-	int glyphsRendered{ 0 };
-	for (auto& glyphRun : textLayout.glyphRuns()) {
+	QList<QGlyphRun> glyphRuns{ textLayout.glyphRuns() };
+	for (auto& glyphRun : glyphRuns) {
 		auto glyphPositionList{ glyphRun.positions() };
-		auto sizeGlyphRun{ glyphPositionList.size() };
-
-		const int cellWidth{ (cell.IsDoubleWidth()) ?
-			m_cellSize.width() * 2 : m_cellSize.width() };
 
 		// When characters are rendered as a string, they may not be uniformly
 		// distributed. Check for even spacing and redistribute as necessary.
@@ -558,6 +724,34 @@ void ShellWidget::paintForegroundTextBlock(
 			glyphRun.setPositions(
 				DistributeGlyphPositions(std::move(glyphPositionList), cellWidth));
 		}
+	}
+
+	m_glyphRunCache.Insert(key, glyphRuns);
+	return glyphRuns;
+}
+
+void ShellWidget::paintForegroundTextBlock(
+	QPainter& p,
+	const Cell& cell,
+	QRect blockRect,
+	const QString& text,
+	int cursorPos) noexcept
+{
+	const HighlightAttribute& hl{ m_contents.highlight(cell) };
+	QColor fgColor{ hl.GetForegroundColor() };
+	if (!fgColor.isValid()) {
+		fgColor = (hl.IsReverse()) ? background() : foreground();
+	}
+
+	p.setPen(fgColor);
+	p.setFont(GetCellFont(cell));
+
+	const int cellTextOffset{ m_lineSpace / 2 };
+	const QPoint pos{ blockRect.left(), blockRect.top() + cellTextOffset };
+
+	int glyphsRendered{ 0 };
+	for (QGlyphRun glyphRun : GetTextBlockGlyphRuns(cell, text, p.device())) {
+		const int sizeGlyphRun{ static_cast<int>(glyphRun.positions().size()) };
 
 		const bool isCursorVisibleInGlyphRun{ m_cursor.IsVisible()
 			&& cursorPos >= 0
@@ -593,13 +787,81 @@ void ShellWidget::paintForegroundTextBlock(
 	}
 }
 
+/// Cells are painted into the backing store as they change, paint events
+/// only copy the exposed region to the widget.
 void ShellWidget::paintEvent(QPaintEvent *ev)
 {
+	rasterizeBackingStore();
+
+	const qreal dpr{ m_backingStore.devicePixelRatio() };
+
 	QPainter p(this);
+	p.setCompositionMode(QPainter::CompositionMode_Source);
+	for (auto rect{ ev->region().cbegin() }; rect != ev->region().cend(); rect++) {
+		const QRectF source{ rect->x() * dpr, rect->y() * dpr,
+			rect->width() * dpr, rect->height() * dpr };
+		p.drawImage(QRectF{ *rect }, m_backingStore, source);
+	}
+}
+
+ShellWidget::RasterState ShellWidget::getRasterState() const noexcept
+{
+	return { background().rgba(), foreground().rgba(), special().rgba(),
+		hasFocus(), m_isLigatureModeEnabled, m_renderFontAttr };
+}
+
+/// Paint the cells damaged since the last paint event into the backing store.
+/// The whole store is repainted when its size, or any widget state used to
+/// paint cells, has changed.
+void ShellWidget::rasterizeBackingStore() noexcept
+{
+	const qreal dpr{ devicePixelRatioF() };
+	const QSize storeSize{ size() * dpr };
+	const QRect shellArea{ absoluteShellRect(0, 0, m_contents.rows(), m_contents.columns()) };
+
+	if (m_backingStore.size() != storeSize || m_backingStore.devicePixelRatio() != dpr) {
+		// Opaque, text drawn into the store may use subpixel antialiasing
+		QImage store{ storeSize, QImage::Format_RGB32 };
+		store.setDevicePixelRatio(dpr);
+
+		// Point size fonts are scaled by the image DPI, match the widget metrics
+		store.setDotsPerMeterX(qRound(logicalDpiX() / 0.0254));
+		store.setDotsPerMeterY(qRound(logicalDpiY() / 0.0254));
+
+		// Keep the cells that are still visible, when only the size changed
+		QRegion preserved;
+		if (m_backingStore.devicePixelRatio() == dpr) {
+			QPainter p{ &store };
+			p.setCompositionMode(QPainter::CompositionMode_Source);
+			p.drawImage(0, 0, m_backingStore);
+			preserved = QRect{ QPoint{}, m_backingStore.size() / dpr }
+				.intersected(m_rasterShellArea)
+				.intersected(shellArea);
+		}
+
+		m_backingStore = store;
+		m_rasterDamage += QRegion{ rect() }.subtracted(preserved);
+	}
+
+	const RasterState state{ getRasterState() };
+	if (!(state == m_rasterState)) {
+		m_rasterState = state;
+		m_rasterDamage = rect();
+	}
+
+	m_rasterShellArea = shellArea;
+	if (m_rasterDamage.isEmpty()) {
+		return;
+	}
+
+	const QRegion damage{ m_rasterDamage.intersected(rect()) };
+	m_rasterDamage = {};
+
+	QPainter p{ &m_backingStore };
 
 	p.setClipping(true);
 
-	for (auto rect{ ev->region().cbegin() }; rect != ev->region().cend(); rect++) {
+	for (auto rect{ damage.cbegin() }; rect != damage.cend(); rect++) {
 		if (isLigatureModeEnabled()) {
 			paintRectLigatures(p, *rect);
 		}
@@ -610,9 +872,8 @@ void ShellWidget::paintEvent(QPaintEvent *ev)
 
 	p.setClipping(false);
 
-	const QRect shellArea{ absoluteShellRect(0, 0, m_contents.rows(), m_contents.columns()) };
 	const QRegion margins{ QRegion(rect()).subtracted(shellArea) };
-	const QRegion marginsIntersected{ margins.intersected(ev->region()) };
+	const QRegion marginsIntersected{ margins.intersected(damage) };
 	for (auto margin{ marginsIntersected.cbegin() }; margin != marginsIntersected.cend(); margin++) {
 		p.fillRect(*margin, background());
 	}
@@ -652,7 +913,7 @@ void ShellWidget::paintRectNoLigatures(QPainter& p, const QRect rect) noexcept
 			QRect r = absoluteShellRect(i, j, 1, chars);
 			QRect ovflw = absoluteShellRect(i, j, 1, chars + 1);
 
-			p.setClipRegion(ovflw);
+			p.setClipRect(ovflw.intersected(rect));
 
 			// Only paint bg/fg if this is not the second cell of a wide char
 			if (j <= 0 || !contents().constValue(i, j-1).IsDoubleWidth()) {
@@ -675,8 +936,8 @@ void ShellWidget::paintRectLigatures(QPainter& p, const QRect rect) noexcept
 {
 	int start_row = rect.top() / m_cellSize.height();
 	int end_row = rect.bottom() / m_cellSize.height();
-	int start_col = 0;
-	int end_col = m_contents.columns() - 1;
+	int start_col = rect.left() / m_cellSize.width();
+	int end_col = rect.right() / m_cellSize.width();
 
 	// Paint margins
 	if (end_col >= m_contents.columns()) {
@@ -686,54 +947,119 @@ void ShellWidget::paintRectLigatures(QPainter& p, const QRect rect) noexcept
 		end_row = m_contents.rows() - 1;
 	}
 
-	// end_col/row is inclusive
+	// end_col/row is inclusive, only the style runs intersecting the rect are
+	// painted, each run is shaped as a single block.
+	p.setClipRect(rect);
 	for (int i=start_row; i<=end_row; i++) {
-		for (int j=start_col; j<=end_col; j++) {
+		int runBegin{ getStyleRunBegin(i, start_col) };
+		while (runBegin <= end_col) {
+			const int runEnd{ getStyleRunEnd(i, runBegin) };
+			paintStyleRun(p, i, runBegin, runEnd);
+			runBegin = runEnd;
+		}
+	}
+}
 
-			const Cell& firstCell{ m_contents.constValue(i,j) };
-			const int chars{ firstCell.IsDoubleWidth() ? 2 : 1 };
-			const QRect firstCellRect{ absoluteShellRect(i, j, 1, chars) };
+void ShellWidget::paintStyleRun(QPainter& p, int row, int col0, int col1) noexcept
+{
+	const Cell& firstCell{ m_contents.constValue(row, col0) };
 
-			QString blockText;
-			int blockCursorPos{ -1 };
+	QString blockText;
+	int blockCursorPos{ -1 };
 
-			while (j <= end_col)
-			{
-				const Cell& checkCell{ m_contents.constValue(i, j) };
+	int j{ col0 };
+	while (j < col1) {
+		const Cell& cell{ m_contents.constValue(row, j) };
 
-				if (!firstCell.IsStyleEquivalent(checkCell)) {
-					j--;
-					break;
-				}
+		const QPoint checkPos{ j, row };
+		if (m_cursor_pos == checkPos) {
+			blockCursorPos = blockText.size();
+		}
 
-				const QPoint checkPos{ j, i };
-				if (m_cursor_pos == checkPos) {
-					blockCursorPos = blockText.size();
-				}
+		blockText += m_contents.text(cell);
 
-				const uint cellCharacter{ checkCell.GetCharacter() };
-				blockText += QString::fromUcs4(&cellCharacter, 1);
+		j += (cell.IsDoubleWidth()) ? 2 : 1;
+	}
 
-				if (checkCell.IsDoubleWidth()) {
-					j++;
-				}
+	const QRect blockRect{ absoluteShellRect(row, col0, 1, col1 - col0) };
 
-				j++;
-			}
+	paintBackgroundClearCell(p, firstCell, blockRect, false);
+	paintForegroundTextBlock(p, firstCell, blockRect, blockText, blockCursorPos);
+	paintUnderline(p, firstCell, blockRect);
+	paintUndercurl(p, firstCell, blockRect);
+	paintStrikeThrough(p, firstCell, blockRect);
+}
+
+/// The end column (exclusive) of the style run starting at col. Runs are
+/// split from the start of the row, a run may not start on the second half
+/// of a double width character.
+int ShellWidget::getStyleRunEnd(int row, int col) const noexcept
+{
+	const int columns{ m_contents.columns() };
+	const Cell& firstCell{ m_contents.constValue(row, col) };
 
-			const Cell& lastCell{ m_contents.constValue(i,j) };
-			int lastCellChars = lastCell.IsDoubleWidth() ? 2 : 1;
-			QRect lastCellRect = absoluteShellRect(i, j, 1, lastCellChars);
+	int j{ col };
+	while (j < columns) {
+		const Cell& checkCell{ m_contents.constValue(row, j) };
+		if (!firstCell.IsStyleEquivalent(checkCell)) {
+			break;
+		}
+
+		j += (checkCell.IsDoubleWidth()) ? 2 : 1;
+	}
 
-			QRect blockRect{ firstCellRect.topLeft(), lastCellRect.bottomRight() };
+	return qMin(qMax(j, col + 1), columns);
+}
+
+/// The start column of the style run containing col, the same run boundaries
+/// as splitting from the start of the row with getStyleRunEnd(). The second
+/// half of a double width character belongs to the run of the first half.
+int ShellWidget::getStyleRunBegin(int row, int col) const noexcept
+{
+	auto isSecondHalf = [&](int j) noexcept {
+		return j > 0 && m_contents.constValue(row, j - 1).IsDoubleWidth();
+	};
 
-			paintBackgroundClearCell(p, firstCell, blockRect, false);
-			paintForegroundTextBlock(p, firstCell, blockRect, blockText, blockCursorPos);
-			paintUnderline(p, firstCell, blockRect);
-			paintUndercurl(p, firstCell, blockRect);
-			paintStrikeThrough(p, firstCell, blockRect);
+	int begin{ qBound(0, col, m_contents.columns() - 1) };
+	if (isSecondHalf(begin)) {
+		begin--;
+	}
+
+	const Cell& cell{ m_contents.constValue(row, begin) };
+	while (begin > 0) {
+		int prev{ begin - 1 };
+		if (isSecondHalf(prev)) {
+			prev--;
 		}
+
+		if (!m_contents.constValue(row, prev).IsStyleEquivalent(cell)) {
+			break;
+		}
+		begin = prev;
 	}
+
+	return begin;
+}
+
+/// Extend the columns [col0, col1) of a row to the style runs painted by
+/// paintRectLigatures. Runs ending or starting exactly at the span edges are
+/// included, they may have been shaped together with the changed cells.
+ShellWidget::DirtySpan ShellWidget::getStyleRunSpan(int row, int col0, int col1) const noexcept
+{
+	DirtySpan span{ col0, col1 };
+
+	// Start with the run ending at col0
+	int runBegin{ getStyleRunBegin(row, col0 - 1) };
+	while (runBegin <= col1 && runBegin < m_contents.columns()) {
+		const int runEnd{ getStyleRunEnd(row, runBegin) };
+		if (runEnd >= col0) {
+			span.begin = qMin(span.begin, runBegin);
+			span.end = qMax(span.end, runEnd);
+		}
+		runBegin = runEnd;
+	}
+
+	return span;
 }
 
 void ShellWidget::resizeEvent(QResizeEvent *ev)
@@ -754,6 +1080,7 @@ void ShellWidget::resizeShell(int n_rows, int n_columns)
 {
 	if (n_rows != rows() || n_columns != columns()) {
 		m_contents.resize(n_rows, n_columns);
+		releaseInterned();
 		updateGeometry();
 	}
 }
@@ -855,27 +1182,37 @@ int ShellWidget::put(
 {
 	int cols_changed = m_contents.put(text, row, column, hl_attr);
 	if (cols_changed > 0) {
-		if (isLigatureModeEnabled()) {
-			update(absoluteShellRectRow(row));
-		}
-		else {
-			QRect rect = absoluteShellRect(row, column, 1, cols_changed);
-			update(rect);
-		}
+		updateCells(row, column, 1, cols_changed);
+	}
+	releaseInternedIfNeeded();
+	return cols_changed;
+}
+
+void ShellWidget::defineHighlight(uint32_t id, const HighlightAttribute& hl_attr) noexcept
+{
+	m_contents.highlights().Define(id, hl_attr);
+}
+
+int ShellWidget::putLine(int row, int column, const LineCell* cells, int count)
+{
+	int cols_changed = m_contents.putLine(row, column, cells, count);
+	if (cols_changed > 0) {
+		updateCells(row, column, 1, cols_changed);
 	}
+	releaseInternedIfNeeded();
 	return cols_changed;
 }
 
 void ShellWidget::clearRow(int row)
 {
 	m_contents.clearRow(row);
-	QRect rect = absoluteShellRectRow(row);
-	update(rect);
+	updateCells(row, 0, 1, m_contents.columns());
 }
 void ShellWidget::clearShell(QColor bg)
 {
 	m_contents.clearAll(bg);
-	update();
+	releaseInterned();
+	updateAll();
 }
 
 /// Clear region (row0, col0) to - but not including (row1, col1)
@@ -883,29 +1220,542 @@ void ShellWidget::clearRegion(int row0, int col0, int row1, int col1)
 {
 	m_contents.clearRegion(row0, col0, row1, col1);
 	// FIXME: check offset error
-	update(absoluteShellRect(row0, col0, row1-row0, col1-col0));
+	updateCells(row0, col0, row1-row0, col1-col0);
 }
 
 /// Scroll count rows (positive numbers move content up)
 void ShellWidget::scrollShell(int rows)
 {
-	if (rows != 0) {
-		m_contents.scroll(rows);
-		// Qt's delta uses positive numbers to move down
-		scroll(0, -rows*m_cellSize.height());
-	}
+	scrollShellRegion(0, m_contents.rows(), 0, m_contents.columns(), rows);
 }
 
 /// Scroll an area, count rows (positive numbers move content up)
 void ShellWidget::scrollShellRegion(int row0, int row1, int col0,
 			int col1, int rows)
 {
-	if (rows != 0) {
-		m_contents.scrollRegion(row0, row1, col0, col1, rows);
-		// Qt's delta uses positive numbers to move down
-		QRect r = absoluteShellRect(row0, col0, row1-row0, col1-col0);
-		scroll(0, -rows*m_cellSize.height(), r);
+	if (rows == 0) {
+		return;
 	}
+
+	m_contents.scrollRegion(row0, row1, col0, col1, rows);
+
+	row0 = qMax(row0, 0);
+	row1 = qMin(row1, m_contents.rows());
+	col0 = qMax(col0, 0);
+	col1 = qMin(col1, m_contents.columns());
+	if (row0 >= row1 || col0 >= col1) {
+		return;
+	}
+
+	// Qt's delta uses positive numbers to move down
+	const QRect area{ absoluteShellRect(row0, col0, row1-row0, col1-col0) };
+	const int dy{ -rows*m_cellSize.height() };
+	scrollBackingStore(area, dy);
+
+	// The cursor is painted in the backing store and moved with the text
+	m_rasterDamage += neovimCursorRect().translated(0, dy).intersected(area);
+
+	// Rows scrolled into the region
+	if (rows > 0) {
+		updateCells(qMax(row0, row1 - rows), col0, qMin(rows, row1 - row0), col1 - col0);
+	}
+	else {
+		updateCells(row0, col0, qMin(-rows, row1 - row0), col1 - col0);
+	}
+
+	presentCells(row0, col0, row1-row0, col1-col0);
+}
+
+/// Move the pixels of an area of the backing store by dy, pixels moved
+/// outside the area are dropped. Damage not yet painted moves with the cells.
+void ShellWidget::scrollBackingStore(const QRect& area, int dy) noexcept
+{
+	const QRegion areaDamage{ m_rasterDamage.intersected(area) };
+	m_rasterDamage = m_rasterDamage.subtracted(area)
+		+ areaDamage.translated(0, dy).intersected(area);
+
+	if (m_backingStore.isNull()) {
+		return;
+	}
+
+	const qreal dpr{ m_backingStore.devicePixelRatio() };
+	const QRect storeArea{ QRect{
+		qRound(area.x() * dpr), qRound(area.y() * dpr),
+		qRound(area.width() * dpr), qRound(area.height() * dpr) }
+		.intersected(m_backingStore.rect()) };
+	const int storeDy{ qRound(dy * dpr) };
+	if (storeArea.isEmpty() || qAbs(storeDy) >= storeArea.height()) {
+		return;
+	}
+
+	const int bytesPerPixel{ m_backingStore.depth() / 8 };
+	const size_t lineBytes{ static_cast<size_t>(storeArea.width() * bytesPerPixel) };
+	const auto bytesPerLine = m_backingStore.bytesPerLine();
+	uchar* const bits{ m_backingStore.bits() + storeArea.left() * bytesPerPixel };
+
+	// Copy lines in the scroll direction, so each source line is read before
+	// it is overwritten.
+	if (storeDy < 0) {
+		for (int y=storeArea.top(); y<=storeArea.bottom() + storeDy; y++) {
+			memcpy(bits + y * bytesPerLine, bits + (y - storeDy) * bytesPerLine, lineBytes);
+		}
+	}
+	else {
+		for (int y=storeArea.bottom(); y>=storeArea.top() + storeDy; y--) {
+			memcpy(bits + y * bytesPerLine, bits + (y - storeDy) * bytesPerLine, lineBytes);
+		}
+	}
+}
+
+void ShellWidget::setFrameBatchingEnabled(bool isEnabled) noexcept
+{
+	if (!isEnabled) {
+		flushFrame();
+	}
+
+	m_isFrameBatchingEnabled = isEnabled;
+}
+
+void ShellWidget::startFrame() noexcept
+{
+	if (!m_isFramePending) {
+		m_isFramePending = true;
+		m_frameTimer.start();
+	}
+}
+
+void ShellWidget::updateCells(int row0, int col0, int rowcount, int colcount) noexcept
+{
+	if (!isLigatureModeEnabled()) {
+		updateCellRect(row0, col0, rowcount, colcount);
+		return;
+	}
+
+	// Ligatures may span a whole style run, any change repaints the runs
+	// around the changed cells.
+	const int row1{ qMin(row0 + rowcount, m_contents.rows()) };
+	const int col1{ qMin(col0 + colcount, m_contents.columns()) };
+	col0 = qMax(col0, 0);
+	if (col0 >= col1) {
+		return;
+	}
+
+	for (int i=qMax(row0, 0); i<row1; i++) {
+		const DirtySpan span{ getStyleRunSpan(i, col0, col1) };
+		updateCellRect(i, span.begin, 1, span.end - span.begin);
+	}
+}
+
+void ShellWidget::updateCellRect(int row0, int col0, int rowcount, int colcount) noexcept
+{
+	m_rasterDamage += absoluteShellRect(row0, col0, rowcount, colcount);
+	presentCells(row0, col0, rowcount, colcount);
+}
+
+void ShellWidget::presentCells(int row0, int col0, int rowcount, int colcount) noexcept
+{
+	if (!m_isFrameBatchingEnabled) {
+		update(absoluteShellRect(row0, col0, rowcount, colcount));
+		return;
+	}
+
+	startFrame();
+	if (m_isFrameDirtyAll) {
+		return;
+	}
+
+	const int row1{ qMin(row0 + rowcount, m_contents.rows()) };
+	const int col1{ qMin(col0 + colcount, m_contents.columns()) };
+	row0 = qMax(row0, 0);
+	col0 = qMax(col0, 0);
+	if (col0 >= col1) {
+		return;
+	}
+
+	m_frameDirtyRows.resize(m_contents.rows());
+	for (int i=row0; i<row1; i++) {
+		DirtySpan& span{ m_frameDirtyRows[i] };
+		if (span.isEmpty()) {
+			span = { col0, col1 };
+		}
+		else {
+			span.begin = qMin(span.begin, col0);
+			span.end = qMax(span.end, col1);
+		}
+	}
+}
+
+void ShellWidget::updateAll() noexcept
+{
+	m_rasterDamage = rect();
+
+	if (!m_isFrameBatchingEnabled) {
+		update();
+		return;
+	}
+
+	startFrame();
+	m_isFrameDirtyAll = true;
+}
+
+void ShellWidget::updateNeovimCursorCell() noexcept
+{
+	const Cell& cell{ contents().constValue(m_cursor_pos.y(), m_cursor_pos.x()) };
+	updateCells(m_cursor_pos.y(), m_cursor_pos.x(), 1, (cell.IsDoubleWidth()) ? 2 : 1);
+}
+
+/// Submit all the repaints deferred since the last frame. Rows with the same
+/// dirty columns are merged into a single rect.
+void ShellWidget::flushFrame()
+{
+	m_frameTimer.stop();
+	if (!m_isFramePending) {
+		return;
+	}
+	m_isFramePending = false;
+
+	if (m_isFrameDirtyAll) {
+		m_isFrameDirtyAll = false;
+		m_frameDirtyRows.assign(m_frameDirtyRows.size(), {});
+		update();
+		return;
+	}
+
+	QRegion damage;
+	const int rowCount{ static_cast<int>(m_frameDirtyRows.size()) };
+	for (int i=0; i<rowCount; i++) {
+		const DirtySpan span{ m_frameDirtyRows[i] };
+		if (span.isEmpty()) {
+			continue;
+		}
+
+		int last{ i };
+		while (last + 1 < rowCount
+			&& m_frameDirtyRows[last + 1].begin == span.begin
+			&& m_frameDirtyRows[last + 1].end == span.end) {
+			last++;
+		}
+
+		damage += absoluteShellRect(i, span.begin, last - i + 1, span.end - span.begin);
+		for (int j=i; j<=last; j++) {
+			m_frameDirtyRows[j] = {};
+		}
+		i = last;
+	}
+
+	if (!damage.isEmpty()) {
+		update(damage);
+	}
+}
+
+void ShellWidget::setMultigridEnabled(bool isEnabled) noexcept
+{
+	if (isEnabled == m_isMultigridEnabled) {
+		return;
+	}
+
+	m_isMultigridEnabled = isEnabled;
+	m_grids.clear();
+	m_gridStack.clear();
+	if (!isEnabled) {
+		return;
+	}
+
+	// The default grid starts with the current contents and stays below
+	// every other grid.
+	Grid& defaultGrid{ m_grids.emplace(std::piecewise_construct,
+		std::forward_as_tuple(DefaultGridId),
+		std::forward_as_tuple(m_contents.rows(), m_contents.columns(), m_contents)).first->second };
+	defaultGrid.contents.copyRegion(m_contents, 0, 0, 0, 0, m_contents.rows(), m_contents.columns());
+	defaultGrid.zindex = std::numeric_limits<int>::min();
+	defaultGrid.isVisible = true;
+	m_gridStack.push_back(DefaultGridId);
+}
+
+ShellWidget::Grid* ShellWidget::findGrid(uint64_t grid) noexcept
+{
+	auto it = m_grids.find(grid);
+	return (it != m_grids.end()) ? &it->second : nullptr;
+}
+
+const ShellWidget::Grid* ShellWidget::findGrid(uint64_t grid) const noexcept
+{
+	auto it = m_grids.find(grid);
+	return (it != m_grids.end()) ? &it->second : nullptr;
+}
+
+QPoint ShellWidget::gridPosition(uint64_t grid) const noexcept
+{
+	const Grid* g{ findGrid(grid) };
+	if (!g) {
+		return {};
+	}
+	return { g->column, g->row };
+}
+
+QRect ShellWidget::gridRect(uint64_t grid) const noexcept
+{
+	if (!m_isMultigridEnabled) {
+		return { 0, 0, m_contents.columns(), m_contents.rows() };
+	}
+
+	const Grid* g{ findGrid(grid) };
+	if (!g) {
+		return {};
+	}
+	return g->area();
+}
+
+void ShellWidget::stackGrid(uint64_t grid, int zindex) noexcept
+{
+	m_gridStack.erase(std::remove(m_gridStack.begin(), m_gridStack.end(), grid),
+		m_gridStack.end());
+
+	auto above = std::find_if(m_gridStack.begin(), m_gridStack.end(),
+		[&](uint64_t other) noexcept { return findGrid(other)->zindex > zindex; });
+	m_gridStack.insert(above, grid);
+}
+
+bool ShellWidget::isGridOccluded(uint64_t grid, const QRect& area) const noexcept
+{
+	auto it = std::find(m_gridStack.begin(), m_gridStack.end(), grid);
+	if (it == m_gridStack.end()) {
+		return true;
+	}
+
+	for (++it; it != m_gridStack.end(); ++it) {
+		if (findGrid(*it)->area().intersects(area)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void ShellWidget::composeCells(const QRect& area) noexcept
+{
+	const QRect shellArea{ area.intersected({ 0, 0, m_contents.columns(), m_contents.rows() }) };
+	if (shellArea.isEmpty()) {
+		return;
+	}
+
+	// Grids below a grid covering the whole area are not visible
+	auto first = m_gridStack.rbegin();
+	while (first != m_gridStack.rend()
+		&& !findGrid(*first)->area().contains(shellArea)) {
+		++first;
+	}
+
+	// Cells that no visible grid covers are blank, e.g. after hiding a float
+	// outside of the default grid.
+	if (first == m_gridStack.rend()) {
+		m_contents.clearRegion(shellArea.top(), shellArea.left(),
+			shellArea.top() + shellArea.height(), shellArea.left() + shellArea.width());
+	}
+
+	auto it = (first != m_gridStack.rend()) ? std::prev(first.base()) : m_gridStack.begin();
+	for (; it != m_gridStack.end(); ++it) {
+		const Grid& g{ *findGrid(*it) };
+		const QRect r{ g.area().intersected(shellArea) };
+		if (!r.isEmpty()) {
+			m_contents.copyRegion(g.contents, r.top() - g.row, r.left() - g.column,
+				r.top(), r.left(), r.height(), r.width());
+		}
+	}
+
+	updateCells(shellArea.top(), shellArea.left(), shellArea.height(), shellArea.width());
+}
+
+int ShellWidget::internedCount() const noexcept
+{
+	return m_contents.highlights().InternedCount() + m_contents.clusters().Count();
+}
+
+void ShellWidget::releaseInterned() noexcept
+{
+	if (internedCount() == 0) {
+		return;
+	}
+
+	const int clusterCount{ m_contents.clusters().Count() };
+
+	ShellContents::Usage usage;
+	m_contents.markUsed(usage);
+	for (const auto& grid : m_grids) {
+		grid.second.contents.markUsed(usage);
+	}
+	m_contents.releaseUnused(usage);
+
+	// Released cluster ids are reused, their cached glyphs are stale
+	if (m_contents.clusters().Count() != clusterCount) {
+		m_glyphCache.Remove(GlyphCache::Cluster);
+	}
+
+	m_internedLimit = 2 * internedCount();
+}
+
+void ShellWidget::releaseInternedIfNeeded() noexcept
+{
+	if (internedCount() > qMax(c_internedLimitMin, m_internedLimit)) {
+		releaseInterned();
+	}
+}
+
+void ShellWidget::resizeGrid(uint64_t grid, int rows, int columns)
+{
+	if (!m_isMultigridEnabled) {
+		return;
+	}
+
+	Grid* g{ findGrid(grid) };
+	if (!g) {
+		// Grids are hidden until they get a position
+		m_grids.emplace(std::piecewise_construct, std::forward_as_tuple(grid),
+			std::forward_as_tuple(rows, columns, m_contents));
+		return;
+	}
+
+	const QRect before{ g->area() };
+	g->contents.resize(rows, columns);
+	if (g->isVisible) {
+		composeCells(before);
+		composeCells(g->area());
+	}
+	releaseInterned();
+}
+
+void ShellWidget::destroyGrid(uint64_t grid)
+{
+	if (grid == DefaultGridId) {
+		return;
+	}
+
+	hideGrid(grid);
+	m_grids.erase(grid);
+	releaseInterned();
+}
+
+int ShellWidget::putGridLine(uint64_t grid, int row, int column, const LineCell* cells, int count)
+{
+	if (!m_isMultigridEnabled) {
+		return putLine(row, column, cells, count);
+	}
+
+	Grid* g{ findGrid(grid) };
+	if (!g) {
+		qDebug() << "Unknown grid" << grid;
+		return 0;
+	}
+
+	const int cols_changed{ g->contents.putLine(row, column, cells, count) };
+	if (cols_changed > 0 && g->isVisible) {
+		composeCells({ g->column + column, g->row + row, cols_changed, 1 });
+	}
+	releaseInternedIfNeeded();
+	return cols_changed;
+}
+
+void ShellWidget::clearGrid(uint64_t grid)
+{
+	if (!m_isMultigridEnabled) {
+		clearShell();
+		return;
+	}
+
+	Grid* g{ findGrid(grid) };
+	if (!g) {
+		return;
+	}
+
+	g->contents.clearAll();
+	if (g->isVisible) {
+		composeCells(g->area());
+	}
+	releaseInterned();
+}
+
+/// Scroll an area of a grid. When no other grid covers the area the pixels
+/// are scrolled with scrollShellRegion(), only the cells scrolled into the
+/// area are repainted.
+void ShellWidget::scrollGridRegion(uint64_t grid, int row0, int row1, int col0,
+			int col1, int rows)
+{
+	if (!m_isMultigridEnabled) {
+		scrollShellRegion(row0, row1, col0, col1, rows);
+		return;
+	}
+
+	Grid* g{ findGrid(grid) };
+	if (!g || rows == 0) {
+		return;
+	}
+
+	g->contents.scrollRegion(row0, row1, col0, col1, rows);
+	if (!g->isVisible) {
+		return;
+	}
+
+	row0 = qMax(row0, 0);
+	row1 = qMin(row1, g->contents.rows());
+	col0 = qMax(col0, 0);
+	col1 = qMin(col1, g->contents.columns());
+	const QRect area{ g->column + col0, g->row + row0, col1 - col0, row1 - row0 };
+	if (area.isEmpty()) {
+		return;
+	}
+
+	const QRect shellArea{ 0, 0, m_contents.columns(), m_contents.rows() };
+	if (!shellArea.contains(area) || isGridOccluded(grid, area)) {
+		composeCells(area);
+		return;
+	}
+
+	scrollShellRegion(area.top(), area.top() + area.height(),
+		area.left(), area.left() + area.width(), rows);
+}
+
+void ShellWidget::setGridPosition(uint64_t grid, int row, int column, int zindex)
+{
+	if (!m_isMultigridEnabled || grid == DefaultGridId) {
+		return;
+	}
+
+	Grid* g{ findGrid(grid) };
+	if (!g) {
+		qDebug() << "Unknown grid" << grid;
+		return;
+	}
+
+	if (g->isVisible && g->row == row && g->column == column && g->zindex == zindex) {
+		return;
+	}
+
+	const QRect before{ g->isVisible ? g->area() : QRect{} };
+	g->row = row;
+	g->column = column;
+	g->zindex = zindex;
+	g->isVisible = true;
+	stackGrid(grid, zindex);
+
+	// The grid cells are kept, moving a grid does not need new contents
+	composeCells(before);
+	composeCells(g->area());
+}
+
+void ShellWidget::hideGrid(uint64_t grid)
+{
+	if (!m_isMultigridEnabled || grid == DefaultGridId) {
+		return;
+	}
+
+	Grid* g{ findGrid(grid) };
+	if (!g || !g->isVisible) {
+		return;
+	}
+
+	g->isVisible = false;
+	m_gridStack.erase(std::remove(m_gridStack.begin(), m_gridStack.end(), grid),
+		m_gridStack.end());
+	composeCells(g->area());
 }
 
 QRect ShellWidget::absoluteShellRect(int row0, int col0, int rowcount, int colcount) const noexcept
@@ -932,25 +1782,14 @@ int ShellWidget::columns() const
 void ShellWidget::setNeovimCursor(uint64_t row, uint64_t col) noexcept
 {
 	// Clear the stale cursor
-	if (isLigatureModeEnabled()) {
-		uint64_t oldCursorRow{ static_cast<uint64_t>(m_cursor_pos.y()) };
-
-		// Ligature mode only requires clear during cursor row changes.
-		if (row != oldCursorRow) {
-			update(absoluteShellRectRow(oldCursorRow));
-		}
-	}
-	else {
-		update(neovimCursorRect());
-	}
+	updateNeovimCursorCell();
 
 	// Update cursor position
 	m_cursor_pos = QPoint(col, row);
 	m_cursor.ResetTimer();
 
 	// Draw cursor at new location
-	update((isLigatureModeEnabled()) ?
-		absoluteShellRectRow(row) : neovimCursorRect());
+	updateNeovimCursorCell();
 }
 
 /// The top left corner position (pixel) for the cursor
@@ -978,6 +1817,13 @@ QRect ShellWidget::neovimCursorRect() const noexcept
 
 void ShellWidget::handleCursorChanged()
 {
+	// Don't paint the cursor cell in the middle of a frame
+	if (isFramePending()) {
+		updateNeovimCursorCell();
+		return;
+	}
+
+	m_rasterDamage += neovimCursorRect();
 	update(neovimCursorRect());
 }
 
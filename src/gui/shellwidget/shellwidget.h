@@ -1,9 +1,17 @@
 #pragma once
 
+#include <QFontMetrics>
+#include <QHash>
+#include <QImage>
+#include <QTimer>
 #include <QWidget>
+#include <unordered_map>
+#include <vector>
 
 #include "shellcontents.h"
 #include "cursor.h"
+#include "glyphcache.h"
+#include "glyphruncache.h"
 
 class ShellWidget: public QWidget
 {
@@ -84,6 +92,67 @@ public:
 	bool renderFontAttr() const;
 	void setRenderFontAttr(bool);
 
+	/// When frame batching is enabled, repaints are deferred until flushFrame()
+	/// is called and then submitted as a single region. A timer flushes the
+	/// frame for clients that never call flushFrame().
+	void setFrameBatchingEnabled(bool isEnabled) noexcept;
+
+	bool isFrameBatchingEnabled() const noexcept
+	{
+		return m_isFrameBatchingEnabled;
+	}
+
+	/// True if there are repaints waiting for flushFrame()
+	bool isFramePending() const noexcept
+	{
+		return m_isFramePending;
+	}
+
+	/// Dirty columns [begin, end) of a single row
+	struct DirtySpan
+	{
+		int begin;
+		int end;
+
+		bool isEmpty() const noexcept { return begin >= end; }
+	};
+
+	/// Style runs painted as single blocks in ligature mode. Testable.
+	int getStyleRunBegin(int row, int col) const noexcept;
+	int getStyleRunEnd(int row, int col) const noexcept;
+
+	/// Extend a dirty span to the style runs painted in ligature mode. Testable.
+	DirtySpan getStyleRunSpan(int row, int col0, int col1) const noexcept;
+
+	/// Number of cached glyph images of the non-ligature paint path
+	int glyphCacheCount() const noexcept { return m_glyphCache.Count(); }
+
+	/// Number of shaped text blocks cached by the ligature paint path
+	int glyphRunCacheCount() const noexcept { return m_glyphRunCache.Count(); }
+
+	/// True if the shell font uses subpixel antialiasing, cells are then
+	/// drawn with drawText and no glyph is cached.
+	bool isSubpixelAntialiased() const noexcept { return m_isSubpixelAntialiased; }
+
+	/// The default grid, with multigrid it is drawn below all other grids
+	static constexpr uint64_t DefaultGridId{ 1 };
+
+	/// When multigrid is enabled each grid keeps its own ShellContents and
+	/// contents() holds the visible grids composed in z-order. Otherwise the
+	/// grid operations ignore the grid id and draw into contents().
+	void setMultigridEnabled(bool isEnabled) noexcept;
+
+	bool isMultigridEnabled() const noexcept
+	{
+		return m_isMultigridEnabled;
+	}
+
+	/// Position of a grid in shell coordinates, x is the column
+	QPoint gridPosition(uint64_t grid) const noexcept;
+
+	/// Area of a grid in shell coordinates, null for unknown grids
+	QRect gridRect(uint64_t grid) const noexcept;
+
 signals:
 	void shellFontChanged();
 	void fontError(const QString& msg);
@@ -125,6 +194,12 @@ public slots:
 		int column,
 		const HighlightAttribute& hl_attr);
 
+	/// Set the style for a highlight id referenced by LineCell::hl_id
+	void defineHighlight(uint32_t id, const HighlightAttribute& hl_attr) noexcept;
+
+	/// Bulk insert a line of cells, see ShellContents::putLine
+	int putLine(int row, int column, const LineCell* cells, int count);
+
 	void clearRow(int row);
 	void clearShell(QColor bg = QColor::Invalid);
 	void clearRegion(int row0, int col0, int row1, int col1);
@@ -132,6 +207,23 @@ public slots:
 	void scrollShellRegion(int row0, int row1, int col0,
 			int col1, int rows);
 	void setLineSpace(int height);
+
+	/// Grid operations, rows and columns are relative to the grid. See
+	/// setMultigridEnabled().
+	void resizeGrid(uint64_t grid, int rows, int columns);
+	void destroyGrid(uint64_t grid);
+	int putGridLine(uint64_t grid, int row, int column, const LineCell* cells, int count);
+	void clearGrid(uint64_t grid);
+	void scrollGridRegion(uint64_t grid, int row0, int row1, int col0,
+			int col1, int rows);
+
+	/// Show a grid at (row, column) of the shell. Grids with a higher zindex
+	/// are drawn on top, grids with the same zindex in the order they are shown.
+	void setGridPosition(uint64_t grid, int row, int column, int zindex);
+	void hideGrid(uint64_t grid);
+
+	/// Submit the repaints accumulated since the last frame
+	void flushFrame();
 protected:
 	/// Cursor position in shell coordinates
 	QPoint m_cursor_pos;
@@ -150,6 +242,13 @@ protected:
 	/// Move the neovim cursor for text insertion and display
 	void setNeovimCursor(uint64_t col, uint64_t row) noexcept;
 
+	/// Repaint every cell. QWidget::update() only repaints cells after a
+	/// change of the colors, focus or paint settings.
+	void updateAll() noexcept;
+
+	/// Repaint the cell under the cursor, use this after cursor style changes
+	void updateNeovimCursorCell() noexcept;
+
 	virtual void paintEvent(QPaintEvent *ev) Q_DECL_OVERRIDE;
 
 	virtual void resizeEvent(QResizeEvent *ev) Q_DECL_OVERRIDE;
@@ -167,6 +266,7 @@ protected:
 	void setGuiFontList(const std::vector<QFont>&& fontList) noexcept
 	{
 		m_guifontwidelist = fontList;
+		updateCellFonts();
 	}
 
 private:
@@ -175,6 +275,7 @@ private:
 	QRect getNeovimCursorRect(QRect cellRect) noexcept;
 	void paintRectLigatures(QPainter& p, QRect rect) noexcept;
 	void paintRectNoLigatures(QPainter& p, QRect rect) noexcept;
+	void paintStyleRun(QPainter& p, int row, int col0, int col1) noexcept;
 	void paintNeovimCursorBackground(QPainter& p, QRect cellRect) noexcept;
 	void paintNeovimCursorForeground(QPainter& p, QRect cellRect, QPoint pos, const QString& character) noexcept;
 	void paintUnderline(QPainter& p, const Cell& cell, QRect cellRect) noexcept;
@@ -183,6 +284,12 @@ private:
 	void paintBackgroundClearCell(QPainter& p, const Cell& cell, QRect cellRect, bool isCursorCell) noexcept;
 	void paintForegroundCellText(QPainter& p, const Cell& cell, QRect cellRect, bool isCursorCell) noexcept;
 
+	/// Shape a block of text, results are cached in m_glyphRunCache
+	QList<QGlyphRun> GetTextBlockGlyphRuns(
+		const Cell& cell,
+		const QString& text,
+		QPaintDevice* device) noexcept;
+
 	void paintForegroundTextBlock(
 		QPainter& p,
 		const Cell& cell,
@@ -190,11 +297,87 @@ private:
 		const QString& text,
 		int cursorPos) noexcept;
 
-	QFont GetCellFont(const Cell& cell) const noexcept;
+	/// Schedule a repaint of a cell area, deferred while frame batching. In
+	/// ligature mode the area is extended to the enclosing style runs.
+	void updateCells(int row0, int col0, int rowcount, int colcount) noexcept;
+	void updateCellRect(int row0, int col0, int rowcount, int colcount) noexcept;
+
+	/// Copy an area of the backing store to the widget, the cells are not repainted
+	void presentCells(int row0, int col0, int rowcount, int colcount) noexcept;
+	void startFrame() noexcept;
+
+	/// Rebuild the cell font table from font() and m_guifontwidelist
+	void updateCellFonts() noexcept;
+
+	const QFont& GetCellFont(const Cell& cell) const noexcept;
+
+	/// Index of the cell font in m_cellFonts
+	int GetCellFontIndex(const Cell& cell) const noexcept;
+	uint32_t GetCellFontVariant(const Cell& cell) const noexcept;
+
+	/// Index of the first font able to render a wide character, 0 for font()
+	/// and i+1 for m_guifontwidelist[i]. Results are cached per code point.
+	int GetWideFontIndex(uint character) const noexcept;
+
+	/// Get the rasterized glyph for a cell, glyphs are rendered on first use
+	QImage GetCellGlyph(const Cell& cell, const QColor& fgColor, qreal devicePixelRatio) noexcept;
 	QPen getForegroundPen(const Cell& cell) noexcept;
 	QPen getSpecialPen(const Cell& cell) noexcept;
 
+	/// A grid drawn into m_contents at a position of the shell
+	struct Grid
+	{
+		Grid(int rows, int columns, const ShellContents& shell) noexcept
+			: contents{ rows, columns, shell }
+		{
+		}
+
+		ShellContents contents;
+		int row{ 0 };
+		int column{ 0 };
+		int zindex{ 0 };
+		bool isVisible{ false };
+
+		/// Area in shell coordinates
+		QRect area() const noexcept
+		{
+			return { column, row, contents.columns(), contents.rows() };
+		}
+	};
+
+	Grid* findGrid(uint64_t grid) noexcept;
+	const Grid* findGrid(uint64_t grid) const noexcept;
+
+	/// Insert a grid in m_gridStack, above the grids with the same zindex
+	void stackGrid(uint64_t grid, int zindex) noexcept;
+
+	/// True if a visible grid above `grid` overlaps `area`
+	bool isGridOccluded(uint64_t grid, const QRect& area) const noexcept;
+
+	/// Copy the visible grids into an area of m_contents, in shell coordinates
+	void composeCells(const QRect& area) noexcept;
+
+	/// Number of interned styles and clusters, see releaseInterned()
+	int internedCount() const noexcept;
+
+	/// Release the interned styles and clusters no longer used by the cells
+	/// of the shell or of any grid.
+	void releaseInterned() noexcept;
+
+	/// Call releaseInterned() once the interned count doubles
+	void releaseInternedIfNeeded() noexcept;
+
 	ShellContents m_contents{ 0, 0 };
+
+	bool m_isMultigridEnabled{ false };
+	std::unordered_map<uint64_t, Grid> m_grids;
+
+	/// Visible grids, from bottom to top
+	std::vector<uint64_t> m_gridStack;
+
+	/// Twice the interned count after the last release
+	int m_internedLimit{ 0 };
+
 	QSize m_cellSize;
 	int m_ascent;
 	QColor m_bgColor{ Qt::white };
@@ -203,6 +386,58 @@ private:
 	int m_lineSpace{ 0 };
 	bool m_isLigatureModeEnabled{ false };
 	bool m_renderFontAttr{ true };
+	GlyphCache m_glyphCache;
+
+	/// Glyphs are not cached when the font uses subpixel antialiasing
+	bool m_isSubpixelAntialiased{ false };
+	GlyphRunCache m_glyphRunCache;
+
+	/// Bold/italic variants of font() followed by those of each wide font,
+	/// indexed by fontIndex * 4 + (variant & (Bold | Italic))
+	std::vector<QFont> m_cellFonts;
+	std::vector<QFontMetrics> m_wideFontMetrics;
+	mutable QHash<uint, int> m_wideFontIndex;
 
 	Background m_background{ Background::Dark };
+
+	bool m_isFrameBatchingEnabled{ false };
+	bool m_isFramePending{ false };
+	bool m_isFrameDirtyAll{ false };
+	std::vector<DirtySpan> m_frameDirtyRows;
+	QTimer m_frameTimer;
+
+	/// Widget state used to paint the cells in the backing store
+	struct RasterState
+	{
+		QRgb background;
+		QRgb foreground;
+		QRgb special;
+		bool hasFocus;
+		bool isLigatureModeEnabled;
+		bool renderFontAttr;
+
+		bool operator==(const RasterState& other) const noexcept
+		{
+			return background == other.background
+				&& foreground == other.foreground
+				&& special == other.special
+				&& hasFocus == other.hasFocus
+				&& isLigatureModeEnabled == other.isLigatureModeEnabled
+				&& renderFontAttr == other.renderFontAttr;
+		}
+	};
+
+	RasterState getRasterState() const noexcept;
+	void rasterizeBackingStore() noexcept;
+	void scrollBackingStore(const QRect& area, int dy) noexcept;
+
+	/// Cells painted by the last paint event, paintEvent() only copies from it
+	QImage m_backingStore;
+
+	/// Areas of the backing store that must be painted from the cells
+	QRegion m_rasterDamage;
+
+	/// Shell area painted in the backing store
+	QRect m_rasterShellArea;
+	RasterState m_rasterState{ 0, 0, 0, false, false, false };
 };
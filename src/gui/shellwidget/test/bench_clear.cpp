@@ -0,0 +1,46 @@
+#include <QtTest/QtTest>
+#include "shellcontents.h"
+
+#if defined(Q_OS_WIN) && defined(USE_STATIC_QT)
+#include <QtPlugin>
+Q_IMPORT_PLUGIN (QWindowsIntegrationPlugin);
+#endif
+
+class Test: public QObject
+{
+	Q_OBJECT
+private slots:
+	// grid_clear, e.g. after :redraw! or a colorscheme change
+	void benchClearAll() {
+		ShellContents s(120, 400);
+		QBENCHMARK {
+			s.clearAll();
+		}
+	}
+
+	void benchClearAllBackground() {
+		ShellContents s(120, 400);
+		QBENCHMARK {
+			s.clearAll(Qt::darkBlue);
+		}
+	}
+
+	void benchClearRegion() {
+		ShellContents s(120, 400);
+		QBENCHMARK {
+			s.clearRegion(10, 100, 110, 300, Qt::darkBlue);
+		}
+	}
+
+	void benchClearRow() {
+		ShellContents s(120, 400);
+		QBENCHMARK {
+			for (int i=0; i<s.rows(); i++) {
+				s.clearRow(i);
+			}
+		}
+	}
+};
+
+QTEST_MAIN(Test)
+#include "bench_clear.moc"
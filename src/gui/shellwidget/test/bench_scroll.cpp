@@ -16,6 +16,22 @@ private slots:
 			s.scroll(100);
 		}
 	}
+
+	// Full width scrolls rotate rows, only the exposed row is cleared
+	void benchScrollFullWidth() {
+		ShellContents s(200, 300);
+		QBENCHMARK {
+			s.scrollRegion(0, 200, 0, 300, 1);
+		}
+	}
+
+	// Partial width scrolls copy every cell of the region
+	void benchScrollPartialWidth() {
+		ShellContents s(200, 300);
+		QBENCHMARK {
+			s.scrollRegion(0, 200, 0, 299, 1);
+		}
+	}
 };
 
 QTEST_MAIN(Test)
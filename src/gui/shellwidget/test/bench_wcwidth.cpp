@@ -0,0 +1,96 @@
+#include <QtTest/QtTest>
+#include <vector>
+#include "konsole_wcwidth.h"
+
+#if defined(Q_OS_WIN) && defined(USE_STATIC_QT)
+#include <QtPlugin>
+Q_IMPORT_PLUGIN (QWindowsIntegrationPlugin);
+#endif
+
+class Test: public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void benchWidth_data();
+	void benchWidth();
+	void benchBisearch_data();
+	void benchBisearch();
+	void benchStringWidth();
+
+private:
+	static std::vector<uint> sampleText(int kind) noexcept;
+};
+
+/// Code points to measure, 0: ASCII, 1: CJK, 2: emoji, 3: mixed
+std::vector<uint> Test::sampleText(int kind) noexcept
+{
+	std::vector<uint> text;
+	for (uint i=0; i<4096; i++) {
+		switch (kind) {
+		case 0: text.push_back(0x20 + i % 0x5f); break;
+		case 1: text.push_back(0x4E00 + i); break;
+		case 2: text.push_back(0x1F300 + i % 0x300); break;
+		default: text.push_back((i % 8 == 0) ? 0x4E00 + i : 0x20 + i % 0x5f); break;
+		}
+	}
+	return text;
+}
+
+void Test::benchWidth_data()
+{
+	QTest::addColumn<int>("kind");
+	QTest::newRow("ascii") << 0;
+	QTest::newRow("cjk") << 1;
+	QTest::newRow("emoji") << 2;
+	QTest::newRow("mixed") << 3;
+}
+
+void Test::benchWidth()
+{
+	QFETCH(int, kind);
+	const std::vector<uint> text{ sampleText(kind) };
+
+	int width{ 0 };
+	QBENCHMARK {
+		for (uint ucs : text) {
+			width += konsole_wcwidth(ucs);
+		}
+	}
+	QVERIFY(width > 0);
+}
+
+void Test::benchBisearch_data()
+{
+	benchWidth_data();
+}
+
+void Test::benchBisearch()
+{
+	QFETCH(int, kind);
+	const std::vector<uint> text{ sampleText(kind) };
+
+	int width{ 0 };
+	QBENCHMARK {
+		for (uint ucs : text) {
+			width += konsole_wcwidth_bisearch(ucs);
+		}
+	}
+	QVERIFY(width > 0);
+}
+
+void Test::benchStringWidth()
+{
+	const std::vector<uint> codePoints{ sampleText(3) };
+	const QString text{ QString::fromUcs4(
+		reinterpret_cast<const char32_t*>(codePoints.data()), static_cast<int>(codePoints.size())) };
+
+	int width{ 0 };
+	QBENCHMARK {
+		width += string_width(text);
+	}
+	QVERIFY(width > 0);
+}
+
+QTEST_MAIN(Test)
+#include "bench_wcwidth.moc"
@@ -13,13 +13,18 @@ private slots:
 	void cellDefault() {
 		Cell c;
 		QCOMPARE(c.GetCharacter(), uint(' '));
+		QCOMPARE(c.GetHighlightId(), HighlightTable::DefaultId);
+		QVERIFY(c.IsValid());
+
 		// Default colors are invalid
-		QCOMPARE(c.GetForegroundColor(), QColor());
-		QCOMPARE(c.GetBackgroundColor(), QColor());
-		QCOMPARE(c.GetSpecialColor(), QColor());
-		QVERIFY(!c.GetForegroundColor().isValid());
-		QVERIFY(!c.GetBackgroundColor().isValid());
-		QVERIFY(!c.GetSpecialColor().isValid());
+		const HighlightTable table;
+		const HighlightAttribute& hl{ table.Get(c.GetHighlightId()) };
+		QCOMPARE(hl.GetForegroundColor(), QColor());
+		QCOMPARE(hl.GetBackgroundColor(), QColor());
+		QCOMPARE(hl.GetSpecialColor(), QColor());
+		QVERIFY(!hl.GetForegroundColor().isValid());
+		QVERIFY(!hl.GetBackgroundColor().isValid());
+		QVERIFY(!hl.GetSpecialColor().isValid());
 
 		QBENCHMARK {
 			Cell c;
@@ -28,15 +33,19 @@ private slots:
 
 	void cellValue() {
 		QBENCHMARK {
-			Cell c('z', Qt::black, Qt::white, QColor(),
-					false, false, false, false, false, false);
+			Cell c('z', 42);
 		}
 	}
-	void cellValueRgb() {
-		QBENCHMARK {
-			Cell c('z', QRgb(33), QRgb(66), QColor(),
-					false, false, false, false, false, false);
-		}
+
+	void cellSize() {
+		QCOMPARE(sizeof(Cell), size_t(8));
+	}
+
+	void cellInvalid() {
+		const Cell c{ Cell::MakeInvalidCell() };
+		QVERIFY(!c.IsValid());
+		QVERIFY(!(c == c));
+		QCOMPARE(c.GetHighlightId(), HighlightTable::InvalidId);
 	}
 
 	void cellWidth() {
@@ -46,20 +55,89 @@ private slots:
 		QCOMPARE(c.IsDoubleWidth(), true);
 	}
 
+	void cellCluster() {
+		const Cell c{ Cell::MakeClusterCell(5, true, 3) };
+		QVERIFY(c.IsCluster());
+		QVERIFY(c.IsDoubleWidth());
+		QCOMPARE(c.GetClusterId(), uint32_t(5));
+		QCOMPARE(c.GetHighlightId(), uint32_t(3));
+
+		// Cluster ids never compare equal to a code point of the same value
+		QVERIFY(!(c == Cell::MakeClusterCell(5, false, 3)));
+		QVERIFY(!(Cell::MakeClusterCell(5, false, 3) == Cell(5, 3)));
+		QVERIFY(!Cell(' ', 0).IsCluster());
+
+		// Clusters and single code points may share a style run
+		QVERIFY(Cell::MakeClusterCell(5, false, 3).IsStyleEquivalent(Cell('a', 3)));
+		QVERIFY(!c.IsStyleEquivalent(Cell('a', 3)));
+	}
+
 	void cellBg() {
+		HighlightTable table;
+		const HighlightAttribute defaultBg{ QColor::Invalid, QColor::Invalid, QColor::Invalid,
+			false, false, false, false, false, false };
+		const HighlightAttribute redBg{ QColor::Invalid, Qt::red, QColor::Invalid,
+			false, false, false, false, false, false };
+
 		Cell c0;
-		Cell c1 = Cell{ QColor::Invalid };
+		Cell c1{ ' ', table.Intern(defaultBg) };
 		QCOMPARE(c0, c1);
 
-		Cell c2 = Cell{ QColor{ Qt::red } };
-		QCOMPARE(c2.GetBackgroundColor(), QColor{ Qt::red });
+		Cell c2{ ' ', table.Intern(redBg) };
+		QCOMPARE(table.Get(c2.GetHighlightId()).GetBackgroundColor(), QColor{ Qt::red });
 	}
 
+	void highlightTable() noexcept;
+
 	void cellOperatorEquals() noexcept;
 
 	void cellStyleEquivalent() noexcept;
 };
 
+void Test::highlightTable() noexcept
+{
+	const HighlightAttribute bold{ Qt::white, Qt::black, QColor::Invalid,
+		false, false, true, false, false, false };
+	const HighlightAttribute italic{ Qt::white, Qt::black, QColor::Invalid,
+		false, true, false, false, false, false };
+
+	HighlightTable table;
+
+	// Neovim ids, unknown ids use the default highlight
+	table.Define(5, bold);
+	QVERIFY(table.Get(5) == bold);
+	QVERIFY(table.Get(4) == HighlightAttribute{});
+	QVERIFY(table.Get(6) == HighlightAttribute{});
+	table.Define(5, italic);
+	QVERIFY(table.Get(5) == italic);
+	QVERIFY(table.IsDefined(5));
+	QVERIFY(!table.IsDefined(4));
+	QVERIFY(!table.IsDefined(HighlightTable::DefaultId));
+
+	// Interned ids do not overlap with Neovim ids
+	const uint32_t boldId{ table.Intern(bold) };
+	QVERIFY(boldId >= HighlightTable::InternedIdBase);
+	QCOMPARE(table.Intern(bold), boldId);
+	QVERIFY(table.Intern(italic) != boldId);
+	QVERIFY(table.Get(boldId) == bold);
+	QCOMPARE(table.Intern(HighlightAttribute{}), HighlightTable::DefaultId);
+
+	QCOMPARE(table.Get(HighlightTable::InvalidId).GetBackgroundColor(), QColor{ Qt::red });
+
+	// Released ids are reused, the table shrinks when the last ids are released
+	const uint32_t italicId{ table.Intern(italic) };
+	QCOMPARE(table.InternedCount(), 2);
+	table.ReleaseInterned({ false, true });
+	QCOMPARE(table.InternedCount(), 1);
+	QVERIFY(table.Get(italicId) == italic);
+	QCOMPARE(table.Intern(italic), italicId);
+	QCOMPARE(table.Intern(bold), boldId);
+	QCOMPARE(table.InternedCount(), 2);
+	table.ReleaseInterned({});
+	QCOMPARE(table.InternedCount(), 0);
+	QCOMPARE(table.Intern(italic), HighlightTable::InternedIdBase);
+}
+
 void Test::cellOperatorEquals() noexcept
 {
 	const HighlightAttribute hlTextBlackFillWhite{
@@ -106,26 +184,32 @@ void Test::cellOperatorEquals() noexcept
 		false /*strikethrough*/,
 		false /*reverse*/ };
 
+	HighlightTable table;
+	const uint32_t idTextBlackFillWhite{ table.Intern(hlTextBlackFillWhite) };
+	const uint32_t idTextWhiteFillBlack{ table.Intern(hlTextWhiteFillBlack) };
+	const uint32_t idInvTextWhiteFillBlack{ table.Intern(hlInvTextWhiteFillBlack) };
+	const uint32_t idBoldTextWhiteFillBlack{ table.Intern(hlBoldTextWhiteFillBlack) };
+
 	bool textDifferent{
-		Cell{ ' ', hlTextBlackFillWhite } == Cell{ 'A', hlTextBlackFillWhite } };
+		Cell{ ' ', idTextBlackFillWhite } == Cell{ 'A', idTextBlackFillWhite } };
 	QVERIFY(textDifferent == false);
 
 	bool textSame{
-		Cell{ 'B', hlTextBlackFillWhite } == Cell{ 'B', hlTextBlackFillWhite } };
+		Cell{ 'B', idTextBlackFillWhite } == Cell{ 'B', idTextBlackFillWhite } };
 	QVERIFY(textSame == true);
 
 	bool colorsDifferent{
-		Cell{ ' ', hlInvTextWhiteFillBlack } == Cell{ ' ', hlTextBlackFillWhite } };
+		Cell{ ' ', idInvTextWhiteFillBlack } == Cell{ ' ', idTextBlackFillWhite } };
 	QVERIFY(colorsDifferent == false);
 
 	// These two styles render identically, but are not equivalent. Their underlying
 	// data is different, so they are treated as different.
 	bool inverseOpposites{
-		Cell{ ' ', hlInvTextWhiteFillBlack } == Cell{ ' ', hlTextBlackFillWhite } };
+		Cell{ ' ', idInvTextWhiteFillBlack } == Cell{ ' ', idTextBlackFillWhite } };
 	QVERIFY(inverseOpposites == false);
 
 	bool stylesDifferent{
-		Cell{ ' ', hlBoldTextWhiteFillBlack } == Cell{ ' ', hlTextWhiteFillBlack } };
+		Cell{ ' ', idBoldTextWhiteFillBlack } == Cell{ ' ', idTextWhiteFillBlack } };
 	QVERIFY(stylesDifferent == false);
 }
 
@@ -153,10 +237,14 @@ void Test::cellStyleEquivalent() noexcept
 		false /*strikethrough*/,
 		false /*reverse*/ };
 
-	Cell cellStyleATextA{ 'A', styleA };
-	Cell cellStyleATextB{ 'B', styleA };
-	Cell cellStyleBTextA{ 'B', styleB };
-	Cell cellStyleBTextB{ 'B', styleB };
+	HighlightTable table;
+	const uint32_t idStyleA{ table.Intern(styleA) };
+	const uint32_t idStyleB{ table.Intern(styleB) };
+
+	Cell cellStyleATextA{ 'A', idStyleA };
+	Cell cellStyleATextB{ 'B', idStyleA };
+	Cell cellStyleBTextA{ 'B', idStyleB };
+	Cell cellStyleBTextB{ 'B', idStyleB };
 
 	QVERIFY(cellStyleATextA.IsStyleEquivalent(cellStyleATextB));
 	QVERIFY(cellStyleATextB.IsStyleEquivalent(cellStyleATextA));
@@ -84,7 +84,7 @@ private slots:
 
 		// invalid cells are initialized as red X
 		QCOMPARE(s.value(-1, -1).GetCharacter(), uint('X'));
-		QCOMPARE(s.value(-1, -1).GetBackgroundColor(), QColor(Qt::red));
+		QCOMPARE(s.highlight(s.value(-1, -1)).GetBackgroundColor(), QColor(Qt::red));
 
 		QBENCHMARK {
 			ShellContents s(100,100);
@@ -217,11 +217,32 @@ private slots:
 		QCOMPARE(s3.value(0, 0), Cell());
 		QCOMPARE(s3.value(0, 1), Cell());
 		QCOMPARE(s3.value(0, 1), Cell());
-		QCOMPARE(s3.value(1, 1), Cell{ QColor{ Qt::blue } });
+		QCOMPARE(s3.value(1, 1).GetCharacter(), uint(' '));
+		QCOMPARE(s3.highlight(s3.value(1, 1)).GetBackgroundColor(), QColor{ Qt::blue });
+		QCOMPARE(s3.value(1, 1), s3.value(2, 2));
 
 		QCOMPARE(s3.value(3, 3), Cell());
 	}
 
+	void clearBackground() {
+		ShellContents s(3, 4);
+		s.clearRegion(0, 0, 1, 4, Qt::blue);
+		s.clearRegion(1, 0, 2, 4, Qt::red);
+		s.clearRegion(2, 0, 3, 4, Qt::blue);
+
+		QCOMPARE(s.value(0, 0), s.value(2, 3));
+		QCOMPARE(s.value(1, 0).GetCharacter(), uint(' '));
+		QVERIFY(!s.value(1, 0).IsDoubleWidth());
+		QCOMPARE(s.highlight(s.value(1, 0)).GetBackgroundColor(), QColor{ Qt::red });
+		QCOMPARE(s.highlight(s.value(2, 0)).GetBackgroundColor(), QColor{ Qt::blue });
+
+		// The default background is the default highlight
+		s.clearAll(Qt::red);
+		s.clearAll();
+		QCOMPARE(s.value(1, 2), Cell());
+		QCOMPARE(Cell::MakeBlankCell(7), (Cell{ ' ', 7 }));
+	}
+
 	void clearAll() {
 		int rows = 26;
 		int cols = 100;
@@ -306,6 +327,50 @@ private slots:
 		}
 	}
 
+	void scrollRegionFullWidth() {
+		int rows = 20;
+		int cols = 10;
+
+		// Full width scrolls reorder rows, other operations must follow
+		ShellContents s0 = initShellScroll(rows, cols);
+		s0.scrollRegion(5, 15, 0, cols, 3);
+		for (int i=5; i<12; i++) {
+			QCOMPARE(s0.value(i, 0).GetCharacter(), uint('a'+i+3));
+		}
+		for (int i=12; i<15; i++) {
+			QCOMPARE(s0.value(i, cols-1), Cell());
+		}
+		QCOMPARE(s0.value(4, 0).GetCharacter(), uint('a'+4));
+		QCOMPARE(s0.value(15, 0).GetCharacter(), uint('a'+15));
+
+		s0.scrollRegion(5, 15, 0, cols, -2);
+		QCOMPARE(s0.value(5, 0), Cell());
+		QCOMPARE(s0.value(6, 0), Cell());
+		QCOMPARE(s0.value(7, 0).GetCharacter(), uint('a'+8));
+
+		// A partial width scroll gives the same cells
+		ShellContents s1 = initShellScroll(rows, cols + 1);
+		s1.scrollRegion(5, 15, 0, cols, 3);
+		s1.scrollRegion(5, 15, 0, cols, -2);
+		for (int i=0; i<rows; i++) {
+			for (int j=0; j<cols; j++) {
+				QCOMPARE(s0.value(i, j), s1.value(i, j));
+			}
+		}
+
+		// Copies and resizes keep the row order
+		const ShellContents s2{ s0 };
+		s0.resize(rows + 1, cols + 1);
+		for (int i=0; i<rows; i++) {
+			QCOMPARE(s2.constValue(i, 1), s1.value(i, 1));
+			QCOMPARE(s0.value(i, 1), s1.value(i, 1));
+		}
+
+		s0.put("x", 7, 1);
+		QCOMPARE(s0.value(7, 1).GetCharacter(), uint('x'));
+		QCOMPARE(s0.value(8, 1).GetCharacter(), uint('a'+9));
+	}
+
 	void put() {
 		int rows = 10;
 		int cols = 10;
@@ -338,6 +403,166 @@ private slots:
 		QCOMPARE(s0.value(5, 9).GetCharacter(), uint('o'));
 	}
 
+	void putLine() {
+		ShellContents s0(2, 10);
+		const HighlightAttribute bold{ Qt::red, Qt::blue, QColor::Invalid,
+			false, false, true, false, false, false };
+		s0.highlights().Define(7, bold);
+
+		// "a", "é" x3, wide "あ" and its empty right half, invalid UTF-8
+		const LineCell cells[]{
+			{ "a", 1, 0, 1 },
+			{ "\xc3\xa9", 2, 7, 3 },
+			{ "\xe3\x81\x82", 3, 0, 1 },
+			{ "", 0, 0, 1 },
+			{ "\xc3", 1, 0, 1 } };
+
+		QCOMPARE(s0.putLine(0, 2, cells, 5), 7);
+		QCOMPARE(s0.value(0, 1), Cell());
+		QCOMPARE(s0.value(0, 2).GetCharacter(), uint('a'));
+		QCOMPARE(s0.value(0, 3), Cell(0xE9, 7));
+		QCOMPARE(s0.value(0, 4), Cell(0xE9, 7));
+		QCOMPARE(s0.value(0, 5), Cell(0xE9, 7));
+		QVERIFY(s0.highlight(s0.value(0, 3)) == bold);
+		QCOMPARE(s0.value(0, 6).GetCharacter(), uint(0x3042));
+		QVERIFY(s0.value(0, 6).IsDoubleWidth());
+		QCOMPARE(s0.value(0, 7), Cell());
+		QCOMPARE(s0.value(0, 8).GetCharacter(), uint(0xFFFD));
+		QCOMPARE(s0.value(0, 9), Cell());
+
+		// Cells past the last column are dropped
+		const LineCell fill[]{ { "x", 1, 0, 100 } };
+		QCOMPARE(s0.putLine(1, 5, fill, 1), 5);
+		QCOMPARE(s0.value(1, 4), Cell());
+		QCOMPARE(s0.value(1, 9).GetCharacter(), uint('x'));
+
+		// Out of bounds
+		QCOMPARE(s0.putLine(2, 0, fill, 1), 0);
+		QCOMPARE(s0.putLine(0, 10, fill, 1), 0);
+	}
+
+	void putLineClusters() {
+		ShellContents s0(2, 8);
+
+		// e + combining acute x2, ZWJ sequence and heart + VS16 with their
+		// empty right halves
+		const LineCell cells[]{
+			{ "e\xcc\x81", 3, 0, 2 },
+			{ "\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9", 11, 0, 1 },
+			{ "", 0, 0, 1 },
+			{ "\xe2\x9d\xa4\xef\xb8\x8f", 6, 0, 1 },
+			{ "", 0, 0, 1 },
+			{ "a", 1, 0, 1 } };
+
+		QCOMPARE(s0.putLine(0, 0, cells, 6), 7);
+		QCOMPARE(s0.clusters().Count(), 3);
+
+		const Cell& accent{ s0.value(0, 0) };
+		QVERIFY(accent.IsCluster());
+		QVERIFY(!accent.IsDoubleWidth());
+		QCOMPARE(s0.text(accent), QString::fromUtf8("e\xcc\x81"));
+		QCOMPARE(s0.baseCharacter(accent), uint('e'));
+		QCOMPARE(s0.value(0, 1), accent);
+		QVERIFY(!(accent == Cell('e', 0)));
+
+		QVERIFY(s0.value(0, 2).IsCluster());
+		QVERIFY(s0.value(0, 2).IsDoubleWidth());
+		QCOMPARE(s0.text(s0.value(0, 2)),
+			QString::fromUtf8("\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9"));
+		QCOMPARE(s0.value(0, 3), Cell());
+
+		QVERIFY(s0.value(0, 4).IsCluster());
+		QVERIFY(s0.value(0, 4).IsDoubleWidth());
+		QCOMPARE(s0.baseCharacter(s0.value(0, 4)), uint(0x2764));
+		QCOMPARE(s0.value(0, 5), Cell());
+
+		QVERIFY(!s0.value(0, 6).IsCluster());
+		QCOMPARE(s0.text(s0.value(0, 6)), QString("a"));
+
+		// put() segments text into the same interned clusters
+		QCOMPARE(s0.put(QString::fromUtf8("e\xcc\x81x"), 1, 0), 2);
+		QCOMPARE(s0.value(1, 0), accent);
+		QCOMPARE(s0.value(1, 1).GetCharacter(), uint('x'));
+		QCOMPARE(s0.clusters().Count(), 3);
+
+		// Grids of a shell share the clusters
+		ShellContents grid(1, 2, s0);
+		QCOMPARE(grid.putLine(0, 0, cells, 1), 2);
+		s0.copyRegion(grid, 0, 0, 1, 0, 1, 2);
+		QCOMPARE(s0.value(1, 1), accent);
+	}
+
+	void releaseUnused() {
+		ShellContents s0(2, 4);
+		ShellContents grid(1, 2, s0);
+		const HighlightAttribute red{ Qt::red, QColor::Invalid, QColor::Invalid,
+			false, false, false, false, false, false };
+		const HighlightAttribute blue{ Qt::blue, QColor::Invalid, QColor::Invalid,
+			false, false, false, false, false, false };
+
+		s0.put("ab", 0, 0, red);
+		grid.put("c", 0, 0, blue);
+		s0.clearAll();
+		QCOMPARE(s0.highlights().InternedCount(), 2);
+
+		// Styles still used by a grid sharing the table are kept
+		ShellContents::Usage usage;
+		s0.markUsed(usage);
+		grid.markUsed(usage);
+		s0.releaseUnused(usage);
+		QCOMPARE(s0.highlights().InternedCount(), 1);
+		QVERIFY(s0.highlight(grid.value(0, 0)) == blue);
+
+		// Clusters are released the same way, their ids are reused
+		const LineCell accent[]{ { "e\xcc\x81", 3, 0, 1 } };
+		const LineCell tilde[]{ { "n\xcc\x83", 3, 0, 1 } };
+		const LineCell ring[]{ { "a\xcc\x8a", 3, 0, 1 } };
+		s0.putLine(0, 0, accent, 1);
+		grid.putLine(0, 1, tilde, 1);
+		s0.clearAll();
+		QCOMPARE(s0.clusters().Count(), 2);
+
+		ShellContents::Usage clusterUsage;
+		s0.markUsed(clusterUsage);
+		grid.markUsed(clusterUsage);
+		s0.releaseUnused(clusterUsage);
+		QCOMPARE(s0.clusters().Count(), 1);
+		QCOMPARE(grid.text(grid.value(0, 1)), QString::fromUtf8("n\xcc\x83"));
+
+		s0.putLine(0, 0, ring, 1);
+		QCOMPARE(s0.value(0, 0).GetClusterId(), uint32_t(0));
+		QCOMPARE(s0.text(s0.value(0, 0)), QString::fromUtf8("a\xcc\x8a"));
+		s0.putLine(1, 0, tilde, 1);
+		QCOMPARE(s0.value(1, 0), grid.value(0, 1));
+		QCOMPARE(s0.clusters().Count(), 2);
+	}
+
+	void copyRegion() {
+		ShellContents s0(4, 6);
+		ShellContents grid(2, 3, s0);
+		grid.put("abc", 0, 0);
+		grid.put("def", 1, 0);
+
+		s0.copyRegion(grid, 0, 0, 1, 2, 2, 3);
+		QCOMPARE(s0.value(1, 2).GetCharacter(), uint('a'));
+		QCOMPARE(s0.value(2, 4).GetCharacter(), uint('f'));
+		QCOMPARE(s0.value(0, 2), Cell());
+		QCOMPARE(s0.value(3, 2), Cell());
+
+		// Areas are clipped to both grids
+		s0.copyRegion(grid, 0, 1, 3, 4, 10, 10);
+		QCOMPARE(s0.value(3, 4).GetCharacter(), uint('b'));
+		QCOMPARE(s0.value(3, 5).GetCharacter(), uint('c'));
+		s0.copyRegion(grid, 0, 0, -1, -2, 2, 3);
+		QCOMPARE(s0.value(0, 0).GetCharacter(), uint('f'));
+
+		// Copies share the styles
+		grid.put("x", 0, 0, { Qt::red, QColor::Invalid, QColor::Invalid,
+			false, false, false, false, false, false });
+		s0.copyRegion(grid, 0, 0, 0, 0, 1, 1);
+		QCOMPARE(s0.highlight(s0.value(0, 0)).GetForegroundColor(), QColor(Qt::red));
+	}
+
 	// Grab test cases from ../test/shellcontents
 	void cases() {
 		QDir dir("../test/shellcontents/");
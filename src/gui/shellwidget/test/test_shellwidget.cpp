@@ -12,6 +12,14 @@ class Test: public QObject
 
 private slots:
 	void clearRegion();
+	void frameBatching();
+	void frameBatchingTimeout();
+	void glyphCache();
+	void glyphRunCache();
+	void styleRuns();
+	void styleRunsDoubleWidth();
+	void backingStoreScroll();
+	void multigrid();
 	void fontDescriptionFromQFont();
 	void fontDescriptionToQFont();
 };
@@ -24,6 +32,289 @@ void Test::clearRegion()
 	w->resizeShell(2, 2);
 }
 
+void Test::frameBatching()
+{
+	ShellWidget w;
+	w.resizeShell(10, 10);
+	QVERIFY(!w.isFrameBatchingEnabled());
+
+	// Without batching updates are not deferred
+	w.put("abc", 0, 0);
+	QVERIFY(!w.isFramePending());
+
+	w.setFrameBatchingEnabled(true);
+	w.put("abc", 1, 0);
+	w.scrollShellRegion(0, 5, 0, 10, 1);
+	w.clearRegion(2, 2, 4, 4);
+	QVERIFY(w.isFramePending());
+	QCOMPARE(w.contents().constValue(0, 0).GetCharacter(), uint('a'));
+
+	w.flushFrame();
+	QVERIFY(!w.isFramePending());
+
+	w.clearShell();
+	QVERIFY(w.isFramePending());
+
+	// Disabling batching flushes the pending frame
+	w.setFrameBatchingEnabled(false);
+	QVERIFY(!w.isFramePending());
+}
+
+void Test::frameBatchingTimeout()
+{
+	ShellWidget w;
+	w.resizeShell(10, 10);
+	w.setFrameBatchingEnabled(true);
+
+	w.put("abc", 0, 0);
+	QVERIFY(w.isFramePending());
+	QTRY_VERIFY(!w.isFramePending());
+}
+
+void Test::glyphCache()
+{
+	ShellWidget w;
+	w.resizeShell(2, 6);
+	w.put("a", 0, 0, Qt::red);
+	w.put("a", 0, 3, Qt::red);
+
+	const QSize cellSize{ w.cellSize() };
+	const QRect firstCell{ 0, 0, cellSize.width(), cellSize.height() };
+	const QRect secondCell{ firstCell.translated(cellSize.width() * 3, 0) };
+
+	// Both cells are painted from the same cached glyph
+	const QImage frame{ w.grab().toImage() };
+	QCOMPARE(frame.copy(firstCell), frame.copy(secondCell));
+	QVERIFY(frame.copy(firstCell) != frame.copy(firstCell.translated(cellSize.width(), 0)));
+
+	// Repainting from the cache gives the same result
+	QCOMPARE(w.grab().toImage(), frame);
+
+	// One image per glyph and color, repaints do not add entries. Nothing is
+	// cached when the font uses subpixel antialiasing.
+	const int cached{ w.isSubpixelAntialiased() ? 0 : 1 };
+	QCOMPARE(w.glyphCacheCount(), cached);
+	w.put("b", 1, 0, Qt::red);
+	w.put("b", 1, 2, Qt::red);
+	w.put("a", 1, 4, Qt::blue);
+	w.grab();
+	QCOMPARE(w.glyphCacheCount(), cached * 3);
+	w.grab();
+	QCOMPARE(w.glyphCacheCount(), cached * 3);
+
+	// Cell size changes invalidate the cache, glyphs are still painted
+	w.setLineSpace(4);
+	const QImage spacedFrame{ w.grab().toImage() };
+	const QRect spacedCell{ 0, 0, w.cellSize().width(), w.cellSize().height() };
+	QVERIFY(spacedFrame.copy(spacedCell) != spacedFrame.copy(spacedCell.translated(w.cellSize().width(), 0)));
+}
+
+void Test::glyphRunCache()
+{
+	ShellWidget w;
+	w.setLigatureMode(true);
+	w.resizeShell(2, 10);
+	w.put("abc abc", 0, 0);
+	w.put("abc abc", 1, 0);
+
+	const QSize cellSize{ w.cellSize() };
+	const QRect firstRow{ 0, 0, cellSize.width() * 10, cellSize.height() };
+	const QRect secondRow{ firstRow.translated(0, cellSize.height()) };
+
+	// Identical blocks are shaped once and painted the same way
+	const QImage frame{ w.grab().toImage() };
+	QCOMPARE(frame.copy(firstRow), frame.copy(secondRow));
+	QCOMPARE(w.glyphRunCacheCount(), 1);
+
+	// Repaints are served from the cache
+	QCOMPARE(w.grab().toImage(), frame);
+	QCOMPARE(w.glyphRunCacheCount(), 1);
+
+	// A new block is shaped once more
+	w.put("xyz", 1, 0);
+	w.grab();
+	QCOMPARE(w.glyphRunCacheCount(), 2);
+	w.grab();
+	QCOMPARE(w.glyphRunCacheCount(), 2);
+}
+
+void Test::styleRuns()
+{
+	ShellWidget w;
+	w.resizeShell(1, 12);
+	w.put("aaaa", 0, 0);
+	w.put("bbbb", 0, 4, Qt::red);
+	w.put("cccc", 0, 8);
+
+	auto span = [&](int col0, int col1) noexcept
+	{
+		const ShellWidget::DirtySpan s{ w.getStyleRunSpan(0, col0, col1) };
+		return QPair<int, int>{ s.begin, s.end };
+	};
+
+	QCOMPARE(w.getStyleRunBegin(0, 6), 4);
+	QCOMPARE(w.getStyleRunEnd(0, 4), 8);
+
+	// A change inside a run repaints the run, which starts before and ends
+	// after the changed columns.
+	QCOMPARE(span(5, 6), qMakePair(4, 8));
+
+	// Runs touching the changed columns are included
+	QCOMPARE(span(4, 8), qMakePair(0, 12));
+	QCOMPARE(span(3, 4), qMakePair(0, 8));
+
+	// Row edges
+	QCOMPARE(w.getStyleRunBegin(0, 0), 0);
+	QCOMPARE(w.getStyleRunEnd(0, 8), 12);
+	QCOMPARE(span(0, 1), qMakePair(0, 4));
+	QCOMPARE(span(11, 12), qMakePair(8, 12));
+	QCOMPARE(span(0, 12), qMakePair(0, 12));
+
+	// A style change inside a run splits it
+	w.put("c", 0, 9, Qt::red);
+	QCOMPARE(w.getStyleRunBegin(0, 11), 10);
+	QCOMPARE(w.getStyleRunEnd(0, 8), 9);
+	QCOMPARE(w.getStyleRunEnd(0, 9), 10);
+	QCOMPARE(span(9, 10), qMakePair(8, 12));
+	QCOMPARE(span(10, 11), qMakePair(9, 12));
+}
+
+void Test::styleRunsDoubleWidth()
+{
+	ShellWidget w;
+	w.resizeShell(1, 10);
+
+	// "x", two red wide characters, red "y"
+	const QString wide{ QString{ QChar{ 0x3042 } } + QChar{ 0x3044 } };
+	w.put("x", 0, 0);
+	w.put(wide, 0, 2, Qt::red);
+	w.put("y", 0, 6, Qt::red);
+
+	// The second half of a wide character belongs to its run
+	QCOMPARE(w.getStyleRunBegin(0, 3), 2);
+	QCOMPARE(w.getStyleRunBegin(0, 5), 2);
+	QCOMPARE(w.getStyleRunEnd(0, 2), 6);
+
+	// Wide and single width cells are painted in different runs
+	QCOMPARE(w.getStyleRunBegin(0, 6), 6);
+	QCOMPARE(w.getStyleRunEnd(0, 6), 7);
+
+	const ShellWidget::DirtySpan s{ w.getStyleRunSpan(0, 5, 6) };
+	QCOMPARE(s.begin, 2);
+	QCOMPARE(s.end, 7);
+}
+
+void Test::backingStoreScroll()
+{
+	ShellWidget w;
+	w.resizeShell(4, 8);
+	w.put("aaaa", 0, 2);
+	w.put("bbbb", 1, 2);
+	w.put("cccc", 2, 2, Qt::red);
+	w.put("dddd", 3, 2, Qt::black, Qt::green);
+
+	const QSize cellSize{ w.cellSize() };
+	auto rowRect = [&](int row) noexcept
+	{
+		return QRect{ cellSize.width() * 2, cellSize.height() * row,
+			cellSize.width() * 4, cellSize.height() };
+	};
+
+	const QImage before{ w.grab().toImage() };
+
+	// Rows are moved in the backing store, and the new rows painted
+	w.scrollShell(1);
+	w.put("eeee", 3, 2);
+	const QImage after{ w.grab().toImage() };
+	for (int i=0; i<3; i++) {
+		QCOMPARE(after.copy(rowRect(i)), before.copy(rowRect(i + 1)));
+	}
+	QVERIFY(after.copy(rowRect(3)) != before.copy(rowRect(3)));
+
+	// Scroll down within a region
+	w.scrollShellRegion(1, 4, 0, 8, -1);
+	const QImage region{ w.grab().toImage() };
+	QCOMPARE(region.copy(rowRect(0)), after.copy(rowRect(0)));
+	QCOMPARE(region.copy(rowRect(2)), after.copy(rowRect(1)));
+	QCOMPARE(region.copy(rowRect(3)), after.copy(rowRect(2)));
+}
+
+void Test::multigrid()
+{
+	ShellWidget w;
+	w.resizeShell(6, 10);
+	w.setMultigridEnabled(true);
+
+	auto character = [&](int row, int col) noexcept
+	{
+		return w.contents().constValue(row, col).GetCharacter();
+	};
+
+	const LineCell a[]{ { "a", 1, 0, 10 } };
+	for (int i=0; i<6; i++) {
+		QCOMPARE(w.putGridLine(ShellWidget::DefaultGridId, i, 0, a, 1), 10);
+	}
+
+	// Grids are hidden until they get a position
+	const LineCell b[]{ { "b", 1, 0, 4 } };
+	w.resizeGrid(2, 3, 4);
+	w.putGridLine(2, 0, 0, b, 1);
+	w.putGridLine(2, 1, 0, b, 1);
+	QCOMPARE(character(1, 2), uint('a'));
+
+	w.setGridPosition(2, 1, 2, 0);
+	QCOMPARE(w.gridPosition(2), QPoint(2, 1));
+	QCOMPARE(w.gridRect(2), QRect(2, 1, 4, 3));
+	QCOMPARE(character(0, 2), uint('a'));
+	QCOMPARE(character(1, 2), uint('b'));
+	QCOMPARE(character(1, 6), uint('a'));
+
+	// Floats are drawn above the windows, changes below them stay hidden
+	const LineCell f[]{ { "f", 1, 0, 2 } };
+	const LineCell x[]{ { "x", 1, 0, 1 } };
+	w.resizeGrid(3, 1, 2);
+	w.putGridLine(3, 0, 0, f, 1);
+	w.setGridPosition(3, 1, 1, 50);
+	w.putGridLine(2, 0, 0, x, 1);
+	QCOMPARE(character(1, 1), uint('f'));
+	QCOMPARE(character(1, 2), uint('f'));
+	QCOMPARE(character(1, 3), uint('b'));
+
+	// Moving a float uncovers the cells below it
+	w.setGridPosition(3, 4, 0, 50);
+	QCOMPARE(character(1, 1), uint('a'));
+	QCOMPARE(character(1, 2), uint('x'));
+	QCOMPARE(character(4, 0), uint('f'));
+
+	// A grid scroll only moves the cells of the grid
+	w.scrollGridRegion(2, 0, 3, 0, 4, 1);
+	QCOMPARE(character(1, 2), uint('b'));
+	QCOMPARE(character(2, 2), uint(' '));
+	QCOMPARE(character(0, 2), uint('a'));
+	QCOMPARE(character(1, 1), uint('a'));
+	QCOMPARE(character(1, 6), uint('a'));
+
+	w.destroyGrid(2);
+	QCOMPARE(character(1, 2), uint('a'));
+	QCOMPARE(w.gridRect(2), QRect());
+
+	w.hideGrid(3);
+	QCOMPARE(character(4, 0), uint('a'));
+
+	// The default grid can not be removed
+	w.destroyGrid(ShellWidget::DefaultGridId);
+	QCOMPARE(w.gridRect(ShellWidget::DefaultGridId), QRect(0, 0, 10, 6));
+
+	// Cells outside of every visible grid are cleared
+	w.resizeGrid(ShellWidget::DefaultGridId, 4, 10);
+	QCOMPARE(character(4, 0), uint(' '));
+	w.setGridPosition(3, 5, 0, 50);
+	QCOMPARE(character(5, 0), uint('f'));
+	w.hideGrid(3);
+	QCOMPARE(character(5, 0), uint(' '));
+	QCOMPARE(character(3, 0), uint('a'));
+}
+
 void Test::fontDescriptionFromQFont()
 {
 	const QString fontFamily{ ShellWidget::getDefaultFontFamily() };
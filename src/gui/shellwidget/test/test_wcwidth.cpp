@@ -0,0 +1,68 @@
+#include <QtTest/QtTest>
+#include "konsole_wcwidth.h"
+
+#if defined(Q_OS_WIN) && defined(USE_STATIC_QT)
+#include <QtPlugin>
+Q_IMPORT_PLUGIN (QWindowsIntegrationPlugin);
+#endif
+
+class Test: public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void lookupMatchesBisearch();
+	void knownWidths();
+	void stringWidth();
+};
+
+void Test::lookupMatchesBisearch()
+{
+	// Every code point, QCOMPARE is too slow to call for each of them
+	uint mismatches{ 0 };
+	uint firstMismatch{ 0 };
+	for (uint ucs=0; ucs<=0x10FFFF; ucs++) {
+		if (konsole_wcwidth(ucs) != konsole_wcwidth_bisearch(ucs)
+			|| konsole_wcwidth_lookup(ucs) != konsole_wcwidth_bisearch(ucs)) {
+			if (mismatches == 0) {
+				firstMismatch = ucs;
+			}
+			mismatches++;
+		}
+	}
+	QCOMPARE(firstMismatch, uint(0));
+	QCOMPARE(mismatches, uint(0));
+
+	// Beyond Unicode
+	for (uint ucs : { 0x110000u, 0x7FFFFFFFu, 0xFFFFFFFFu }) {
+		QCOMPARE(konsole_wcwidth(ucs), konsole_wcwidth_bisearch(ucs));
+	}
+}
+
+void Test::knownWidths()
+{
+	QCOMPARE(konsole_wcwidth(0), 0);
+	QCOMPARE(konsole_wcwidth('\n'), -1);
+	QCOMPARE(konsole_wcwidth(0x7F), -1);
+	QCOMPARE(konsole_wcwidth(' '), 1);
+	QCOMPARE(konsole_wcwidth('~'), 1);
+	QCOMPARE(konsole_wcwidth(0xE9), 1);     // Latin small letter e with acute
+	QCOMPARE(konsole_wcwidth(0x0301), 0);   // Combining acute accent
+	QCOMPARE(konsole_wcwidth(0x4E2D), 2);   // CJK ideograph
+	QCOMPARE(konsole_wcwidth(0x1F600), 2);  // Grinning face emoji
+	QCOMPARE(konsole_wcwidth(0x20000), 2);
+}
+
+void Test::stringWidth()
+{
+	QCOMPARE(string_width(QString{}), 0);
+	QCOMPARE(string_width(QStringLiteral("abc")), 3);
+	QCOMPARE(string_width(QString::fromUcs4(U"a\u4E2Db")), 4);
+
+	// Surrogate pairs are a single character
+	QCOMPARE(string_width(QString::fromUcs4(U"\U0001F600")), 2);
+	QCOMPARE(string_width(QString::fromUcs4(U"\U00010400")), 1);
+}
+
+QTEST_MAIN(Test)
+#include "test_wcwidth.moc"
@@ -11,6 +11,7 @@
 #include <QVariant>
 
 #include "msgpackrequest.h"
+#include "neovimbatch.h"
 
 static constexpr auto cs_showBuffersOptionName { "Tabline/OptionShowBuffers" };
 static constexpr auto cs_showTablineOptionName { "ext_tabline" };
@@ -295,6 +296,9 @@ static QIcon GetIconFromFilePath(const QString& path) noexcept
 	}
 }
 
+/// Buffer path requests are dropped if Neovim does not reply in time
+constexpr int c_bufferPathTimeoutMs{ 10000 };
+
 static void SetTabIconAndTooltipCallback(
 	QPointer<QTabBar> bufferline, int bufIndex, const QVariant& resp) noexcept
 {
@@ -340,6 +344,9 @@ void Tabline::updateTabControl(
 		tabControl.removeTab(i);
 	}
 
+	// Optional: Add filetype icons, all buffer paths are requested at once
+	NeovimBatch* reqBufferPaths{ (drawTabIcons && nvimApi0) ? m_nvim.startBatch() : nullptr };
+
 	int tabIndex{ 0 };
 	for (const auto& tab : tabList) {
 		// Required: Set Tab Text
@@ -364,21 +371,36 @@ void Tabline::updateTabControl(
 			tabControl.setCurrentIndex(tabIndex);
 		}
 
-		// Optional: Add filetype icons
-		if (drawTabIcons && nvimApi0) {
-			auto reqBufferPath{ nvimApi0->vim_eval(
-				QStringLiteral("expand('#%1:p')").arg(tab.GetHandle()).toLatin1()) };
-
-			QPointer<QTabBar> spTabControl{ &tabControl };
-			auto handle = [spTabControl, tabIndex](quint32, quint64, const QVariant& resp) noexcept
-			{
-				SetTabIconAndTooltipCallback(spTabControl, tabIndex, resp);
-			};
-			connect(reqBufferPath, &MsgpackRequest::finished, this, handle);
+		if (reqBufferPaths) {
+			reqBufferPaths->call("vim_eval",
+				{ QStringLiteral("expand('#%1:p')").arg(tab.GetHandle()).toLatin1() });
 		}
 
 		tabIndex++;
 	}
+
+	if (reqBufferPaths) {
+		QPointer<QTabBar> spTabControl{ &tabControl };
+		auto handle = [spTabControl](const QVariantList& results) noexcept
+		{
+			for (int i = 0; i < results.size(); i++) {
+				SetTabIconAndTooltipCallback(spTabControl, i, results.at(i));
+			}
+		};
+		connect(reqBufferPaths, &NeovimBatch::finished, this, handle);
+
+		// Neovim stops at the first failed call, the earlier tabs still get
+		// their icons.
+		auto handleError = [handle](int index, const QVariant& err, const QVariantList& results) noexcept
+		{
+			qWarning() << "Failed to get the buffer path of tab" << index << err;
+			handle(results);
+		};
+		connect(reqBufferPaths, &NeovimBatch::error, this, handleError);
+
+		reqBufferPaths->setTimeout(c_bufferPathTimeoutMs);
+		reqBufferPaths->submit();
+	}
 }
 
 void Tabline::updateTablineVisibility() noexcept
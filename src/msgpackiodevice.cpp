@@ -1,5 +1,8 @@
+#include <cerrno>
 #include <QAbstractSocket>
+#include <QLocalSocket>
 #include <QSocketNotifier>
+#include <QTimer>
 
 // read/write
 #ifdef _WIN32
@@ -10,11 +13,18 @@
 #endif
 
 #include "msgpackiodevice.h"
-#include "util.h"
+#include "msgpackparser.h"
+#include "msgpackredraw.h"
 #include "msgpackrequest.h"
+#include "util.h"
 
 namespace NeovimQt {
 
+constexpr int MsgpackIODevice::c_writeBufferFlushSize;
+constexpr size_t MsgpackIODevice::c_readReserveMin;
+constexpr size_t MsgpackIODevice::c_readReserveMax;
+constexpr int MsgpackIODevice::c_requestPoolMax;
+
 /**
  * \class NeovimQt::MsgpackIODevice
  * 
@@ -29,11 +39,12 @@ namespace NeovimQt {
 MsgpackIODevice* MsgpackIODevice::fromStdinOut(QObject *parent)
 {
 	MsgpackIODevice *rpc = new MsgpackIODevice(NULL, parent);
-	msgpack_packer_init(&rpc->m_pk, rpc, (msgpack_packer_write)MsgpackIODevice::msgpack_write_to_stdout);
 #ifdef _WIN32
 	StdinReader *rsn = new StdinReader(msgpack_unpacker_buffer_capacity(&rpc->m_uk), rpc);
 	connect(rsn, &StdinReader::dataAvailable,
 			rpc, &MsgpackIODevice::dataAvailableStdin);
+	connect(rsn, &QThread::finished,
+			rpc, &MsgpackIODevice::inputClosed);
 	rsn->start();
 #else
 	QSocketNotifier *rsn = new QSocketNotifier(0, QSocketNotifier::Read, rpc);
@@ -53,10 +64,15 @@ MsgpackIODevice::MsgpackIODevice(QIODevice* dev, QObject* parent)
 	qRegisterMetaType<MsgpackError>("MsgpackError");
 	msgpack_unpacker_init(&m_uk, MSGPACK_UNPACKER_INIT_BUFFER_SIZE);
 
-	if (m_dev) {
-		// MSVC: wont build without the (mspack_packer_write) cast
-		msgpack_packer_init(&m_pk, this, (msgpack_packer_write)MsgpackIODevice::msgpack_write_to_dev);
+	m_clock.start();
+	m_timeoutTimer.setSingleShot(true);
+	connect(&m_timeoutTimer, &QTimer::timeout,
+			this, &MsgpackIODevice::expireRequests);
+
+	// MSVC: wont build without the (mspack_packer_write) cast
+	msgpack_packer_init(&m_pk, this, (msgpack_packer_write)MsgpackIODevice::msgpack_write_to_buffer);
 
+	if (m_dev) {
 		m_dev->setParent(this);
 		connect(m_dev, &QAbstractSocket::readyRead,
 				this, &MsgpackIODevice::dataAvailable);
@@ -71,6 +87,8 @@ MsgpackIODevice::MsgpackIODevice(QIODevice* dev, QObject* parent)
 
 MsgpackIODevice::~MsgpackIODevice()
 {
+	flushWriteBuffer();
+	delete m_parser;
 	//msgpack_packer_destroy(&m_pk);
 	msgpack_unpacker_destroy(&m_uk);
 }
@@ -86,24 +104,119 @@ bool MsgpackIODevice::isOpen()
 	}
 }
 
-int MsgpackIODevice::msgpack_write_to_stdout(void* data, const char* buf, unsigned long int len)
+/**
+ * Packer callback, outgoing data is buffered until the next event loop
+ * iteration so that a burst of messages reaches the device in a single write.
+ */
+int MsgpackIODevice::msgpack_write_to_buffer(void* data, const char* buf, unsigned long int len)
 {
 	MsgpackIODevice *c = static_cast<MsgpackIODevice*>(data);
-	qint64 bytes = write(1, buf, len);
-	if (bytes == -1) {
-		c->setError(InvalidDevice, tr("Error writing to device"));
+	c->m_writeBuffer.append(buf, len);
+
+	if (c->m_writeBuffer.size() >= c_writeBufferFlushSize) {
+		c->flushWriteBuffer();
+	} else if (!c->m_writeScheduled) {
+		c->m_writeScheduled = true;
+		QTimer::singleShot(0, c, &MsgpackIODevice::flushWriteBuffer);
 	}
-	return bytes;
+	return 0;
 }
 
-int MsgpackIODevice::msgpack_write_to_dev(void* data, const char* buf, unsigned long int len)
+/**
+ * Write all buffered outgoing data to the device (or stdout).
+ *
+ * This is called once per event loop iteration, call it directly if
+ * the data must be written before returning to the event loop.
+ */
+void MsgpackIODevice::flushWriteBuffer()
 {
-	MsgpackIODevice *c = static_cast<MsgpackIODevice*>(data);
-	qint64 bytes = c->m_dev->write(buf, len);
-	if (bytes == -1) {
-		c->setError(InvalidDevice, tr("Error writing to device"));
+	m_writeScheduled = false;
+	if (m_writeBuffer.isEmpty()) {
+		return;
+	}
+
+	if (m_dev) {
+		if (m_dev->write(m_writeBuffer) == -1) {
+			setError(InvalidDevice, tr("Error writing to device"));
+		}
+
+		// Sockets queue writes until the event loop runs, hand the data
+		// to the OS now instead.
+		if (QAbstractSocket* socket = qobject_cast<QAbstractSocket*>(m_dev)) {
+			socket->flush();
+		} else if (QLocalSocket* socket = qobject_cast<QLocalSocket*>(m_dev)) {
+			socket->flush();
+		}
+	} else {
+		const char* buf = m_writeBuffer.constData();
+		qint64 remaining = m_writeBuffer.size();
+		while (remaining > 0) {
+			qint64 bytes = write(1, buf, remaining);
+			if (bytes == -1) {
+				setError(InvalidDevice, tr("Error writing to device"));
+				break;
+			}
+			buf += bytes;
+			remaining -= bytes;
+		}
+	}
+
+	m_writeBuffer.clear();
+}
+
+/**
+ * Make room for at least size bytes in the unpacker buffer
+ */
+bool MsgpackIODevice::reserveReadBuffer(size_t size)
+{
+	if (msgpack_unpacker_buffer_capacity(&m_uk) >= size) {
+		return true;
+	}
+
+	if (!msgpack_unpacker_reserve_buffer(&m_uk, size)) {
+		qFatal("Could not allocate memory in unpack buffer");
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Dispatch every complete message in the unpacker buffer, then adapt the
+ * read size to the amount of data that arrived in this burst.
+ *
+ * Once the device is idle at the smallest read size an oversized unpacker
+ * buffer is released.
+ */
+void MsgpackIODevice::dispatchReadBuffer(size_t bytesRead)
+{
+	msgpack_unpacked result;
+	msgpack_unpacked_init(&result);
+	while(msgpack_unpacker_next(&m_uk, &result)) {
+		dispatch(result.data);
+	}
+	msgpack_unpacked_destroy(&result);
+
+	adaptReadReserve(bytesRead);
+
+	if (m_readReserve == c_readReserveMin
+			&& msgpack_unpacker_nonparsed_size(&m_uk) == 0
+			&& m_uk.used + m_uk.free > c_readReserveMax) {
+		msgpack_unpacker_destroy(&m_uk);
+		msgpack_unpacker_init(&m_uk, MSGPACK_UNPACKER_INIT_BUFFER_SIZE);
+	}
+}
+
+/**
+ * The read size doubles while reads fill it and halves while bursts use
+ * less than a quarter of it.
+ */
+void MsgpackIODevice::adaptReadReserve(size_t bytesRead)
+{
+	if (bytesRead >= m_readReserve) {
+		m_readReserve = qMin(m_readReserve * 2, c_readReserveMax);
+	} else if (bytesRead < m_readReserve / 4) {
+		m_readReserve = qMax(m_readReserve / 2, c_readReserveMin);
 	}
-	return bytes;
 }
 
 /**
@@ -113,73 +226,176 @@ int MsgpackIODevice::msgpack_write_to_dev(void* data, const char* buf, unsigned
  */
 void MsgpackIODevice::dataAvailableStdin(const QByteArray& data)
 {
-	if ( (quint64)data.length() > msgpack_unpacker_buffer_capacity(&m_uk)) {
-		setError(InvalidDevice, tr("Error when reading from stdin, BUG(buffered data exceeds capaciy)"));
+	if (m_parser) {
+		pushParserInput(data);
+		return;
+	}
+
+	if (data.isEmpty() || !reserveReadBuffer(data.length())) {
 		return;
-	} else if ( data.length() > 0 ) {
-		memcpy(msgpack_unpacker_buffer(&m_uk), data.constData(), data.length());
-		msgpack_unpacker_buffer_consumed(&m_uk, data.length());
-		msgpack_unpacked result;
-		msgpack_unpacked_init(&result);
-		while(msgpack_unpacker_next(&m_uk, &result)) {
-			dispatch(result.data);
-		}
 	}
+
+	memcpy(msgpack_unpacker_buffer(&m_uk), data.constData(), data.length());
+	msgpack_unpacker_buffer_consumed(&m_uk, data.length());
+	dispatchReadBuffer(data.length());
 }
 
 /**
  * Process incoming data from the given fd.
  *
+ * The fd may be blocking, only one read is done per notification.
+ *
  * \see fromStdinOut() and QSocketNotifier()
  */
 void MsgpackIODevice::dataAvailableFd(int fd)
 {
-	if ( msgpack_unpacker_buffer_capacity(&m_uk) == 0 ) {
-		if ( !msgpack_unpacker_reserve_buffer(&m_uk, 8192 ) ) {
-			qFatal("Could not allocate memory in unpack buffer");
+	qint64 bytes;
+	if (m_parser) {
+		QByteArray data(static_cast<int>(m_readReserve), Qt::Uninitialized);
+		bytes = read(fd, data.data(), data.size());
+		if (bytes > 0) {
+			data.resize(bytes);
+			pushParserInput(data);
+			adaptReadReserve(bytes);
+			return;
+		}
+	} else {
+		if (!reserveReadBuffer(m_readReserve)) {
 			return;
 		}
-	}
 
-	qint64 bytes = read(fd, msgpack_unpacker_buffer(&m_uk),
-			msgpack_unpacker_buffer_capacity(&m_uk));
-	if (bytes > 0) {
-		msgpack_unpacker_buffer_consumed(&m_uk, bytes);
-		msgpack_unpacked result;
-		msgpack_unpacked_init(&result);
-		while(msgpack_unpacker_next(&m_uk, &result)) {
-			dispatch(result.data);
+		bytes = read(fd, msgpack_unpacker_buffer(&m_uk),
+				msgpack_unpacker_buffer_capacity(&m_uk));
+		if (bytes > 0) {
+			msgpack_unpacker_buffer_consumed(&m_uk, bytes);
+			dispatchReadBuffer(bytes);
+			return;
 		}
-	} else if (bytes == -1) {
+	}
+
+	if (bytes == -1 && (errno == EINTR || errno == EAGAIN)) {
+		return;
+	}
+
+	// EOF or a read error, the notifier would otherwise keep firing
+	if (QSocketNotifier* notifier = qobject_cast<QSocketNotifier*>(sender())) {
+		notifier->setEnabled(false);
+	}
+
+	if (bytes == 0) {
+		inputClosed();
+	} else {
 		setError(InvalidDevice, tr("Error when reading from device"));
 	}
 }
 
+/**
+ * The input stream reached EOF, Neovim closed the channel.
+ */
+void MsgpackIODevice::inputClosed()
+{
+	emit aboutToClose();
+	setError(InvalidDevice, tr("Connection closed by Neovim"));
+}
+
 /**
  * Process incoming data from the underlying device
  *
+ * The device is drained before any message is dispatched, a large redraw
+ * batch is read with as few buffer reservations as possible.
+ *
  * \see QIODevice()
  */
 void MsgpackIODevice::dataAvailable()
 {
-	qint64 read = 1;
-	while (read > 0) {
-		if ( msgpack_unpacker_buffer_capacity(&m_uk) == 0 ) {
-			if ( !msgpack_unpacker_reserve_buffer(&m_uk, 8192 ) ) {
-				qFatal("Could not allocate memory in unpack buffer");
-				return;
-			}
+	if (m_parser) {
+		pushParserInput(m_dev->readAll());
+		return;
+	}
+
+	size_t total = 0;
+	while (true) {
+		const size_t available = static_cast<size_t>(qMax<qint64>(m_dev->bytesAvailable(), 0));
+		if (total > 0 && available == 0) {
+			break;
+		}
+		if (!reserveReadBuffer(qMax(available, m_readReserve))) {
+			return;
 		}
 
-		read = m_dev->read(msgpack_unpacker_buffer(&m_uk), msgpack_unpacker_buffer_capacity(&m_uk));
-		if ( read > 0 ) {
-			msgpack_unpacker_buffer_consumed(&m_uk, read);
-			msgpack_unpacked result;
-			msgpack_unpacked_init(&result);
-			while(msgpack_unpacker_next(&m_uk, &result)) {
-				dispatch(result.data);
-			}
+		qint64 read = m_dev->read(msgpack_unpacker_buffer(&m_uk), msgpack_unpacker_buffer_capacity(&m_uk));
+		if (read <= 0) {
+			break;
 		}
+		msgpack_unpacker_buffer_consumed(&m_uk, read);
+		total += read;
+	}
+
+	if (total > 0) {
+		dispatchReadBuffer(total);
+	}
+}
+
+/**
+ * Move msgpack parsing to a background thread.
+ *
+ * Incoming data is still read in this thread, but unpacking happens in a
+ * MsgpackParser thread and only complete messages are dispatched here. The
+ * data read is handed over without copying it again. This must be called
+ * before any partial message has been received, i.e. right after the device
+ * is created. Returns false if parsing can't be moved.
+ */
+bool MsgpackIODevice::startParserThread()
+{
+	if (m_parser) {
+		return true;
+	}
+
+	if (msgpack_unpacker_parsed_size(&m_uk) != 0
+			|| msgpack_unpacker_nonparsed_size(&m_uk) != 0) {
+		qWarning() << "Unable to start the msgpack parser thread, a message is partially received";
+		return false;
+	}
+
+	m_parser = new MsgpackParser();
+	connect(m_parser, &MsgpackParser::messagesAvailable,
+			this, &MsgpackIODevice::dispatchParsed);
+	m_parser->start();
+	return true;
+}
+
+/**
+ * Hand raw data to the parser thread, data that does not fit in the parser
+ * queue is kept until the next batch of messages is dispatched. The data is
+ * shared with the parser, not copied, unless it has to wait.
+ */
+void MsgpackIODevice::pushParserInput(const QByteArray& data)
+{
+	if (m_parserInput.isEmpty()) {
+		m_parserInput = data;
+	} else {
+		m_parserInput.append(data);
+	}
+	if (!m_parserInput.isEmpty() && m_parser->push(m_parserInput)) {
+		m_parserInput.clear();
+	}
+}
+
+/**
+ * Dispatch messages parsed by the parser thread
+ */
+void MsgpackIODevice::dispatchParsed()
+{
+	m_parser->clearNotification();
+
+	MsgpackParser::Message msg;
+	while (m_parser->pop(msg)) {
+		dispatch(msg.data);
+		msgpack_zone_free(msg.zone);
+	}
+
+	if (!m_parserInput.isEmpty()) {
+		pushParserInput(QByteArray());
 	}
 }
 
@@ -310,6 +526,19 @@ void MsgpackIODevice::setRequestHandler(MsgpackRequestHandler *h)
 	m_reqHandler = h;
 }
 
+/**
+ * Assign a handler for Neovim redraw notifications.
+ *
+ * When set, "redraw" notifications are decoded in place and delivered to the
+ * handler. The grid events consumed by the typed callbacks are not emitted
+ * through notification(); the remaining events are re-emitted as a "redraw"
+ * notification after the handler has processed the batch.
+ */
+void MsgpackIODevice::setRedrawHandler(MsgpackRedrawHandler *h)
+{
+	m_redrawHandler = h;
+}
+
 /**
  * Send back a response [type(1), msgid(uint), error(...), result(...)]
  */
@@ -370,6 +599,13 @@ void MsgpackIODevice::dispatchResponse(msgpack_object& resp)
 			goto err;
 		}
 		emit req->error(req->id, req->function(), val);
+	} else if (req->m_decoder) {
+		if (req->m_decoder(this, resp.via.array.ptr[3])) {
+			qWarning() << "Error decoding response object";
+			emit req->error(req->id, req->function(), QStringLiteral("Error decoding response object"));
+		} else {
+			emit req->finished(req->id, req->function(), QVariant());
+		}
 	} else {
 		QVariant val;
 		if (decodeMsgpack(resp.via.array.ptr[3], val)) {
@@ -379,7 +615,7 @@ void MsgpackIODevice::dispatchResponse(msgpack_object& resp)
 		emit req->finished(req->id, req->function(), val);
 	}
 err:
-	req->deleteLater();
+	releaseRequest(req);
 }
 
 /** Return list of pending request ids */
@@ -400,6 +636,12 @@ void MsgpackIODevice::dispatchNotification(msgpack_object& nt)
 		return;
 	}
 
+	if (m_redrawHandler && methodName == "redraw"
+			&& nt.via.array.ptr[2].type == MSGPACK_OBJECT_ARRAY) {
+		dispatchRedraw(nt.via.array.ptr[2]);
+		return;
+	}
+
 	QVariant val; 
 	if (decodeMsgpack(nt.via.array.ptr[2], val) ||
 			(QMetaType::Type)val.type() != QMetaType::QVariantList  ) {
@@ -409,6 +651,132 @@ void MsgpackIODevice::dispatchNotification(msgpack_object& nt)
 	emit notification(methodName, val.toList());
 }
 
+/**
+ * Deliver a typed redraw event. Returns false if the event is not one of the
+ * typed events, or its arguments do not match the expected format.
+ */
+static bool dispatchTypedRedrawEvent(
+	MsgpackRedrawHandler& handler,
+	const MsgpackStringView& name,
+	const msgpack_object& args) noexcept
+{
+	const msgpack_object* arg{ args.via.array.ptr };
+	const uint32_t argc{ args.via.array.size };
+
+	if (name == "grid_line") {
+		// [grid, row, col_start, cells, wrap?]
+		if (argc < 4
+			|| !isUnsignedInteger(arg[0])
+			|| !isUnsignedInteger(arg[1])
+			|| !isUnsignedInteger(arg[2])
+			|| arg[3].type != MSGPACK_OBJECT_ARRAY) {
+			return false;
+		}
+
+		GridLineEvent ev;
+		ev.grid = arg[0].via.u64;
+		ev.row = arg[1].via.u64;
+		ev.colStart = arg[2].via.u64;
+		ev.cells = { arg[3].via.array.ptr, arg[3].via.array.size };
+		if (!ev.cells.isValid()) {
+			return false;
+		}
+
+		handler.handleGridLine(ev);
+		return true;
+	}
+
+	if (name == "grid_cursor_goto") {
+		// [grid, row, col]
+		if (argc < 3
+			|| !isUnsignedInteger(arg[0])
+			|| !isUnsignedInteger(arg[1])
+			|| !isUnsignedInteger(arg[2])) {
+			return false;
+		}
+
+		handler.handleGridCursorGoto(arg[0].via.u64, arg[1].via.u64, arg[2].via.u64);
+		return true;
+	}
+
+	if (name == "grid_clear") {
+		// [grid]
+		if (argc < 1 || !isUnsignedInteger(arg[0])) {
+			return false;
+		}
+
+		handler.handleGridClear(arg[0].via.u64);
+		return true;
+	}
+
+	if (name == "flush") {
+		handler.handleFlush();
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * Walk a redraw batch [[name, args...], ...] without building a QVariant
+ * tree for the whole batch.
+ *
+ * Typed events are passed to the redraw handler as views into the unpacker
+ * zone. Every other event is decoded individually, passed to the handler,
+ * and then re-emitted as a "redraw" notification for other listeners.
+ */
+void MsgpackIODevice::dispatchRedraw(const msgpack_object& batch)
+{
+	QVariantList residual;
+
+	for (uint32_t i=0; i<batch.via.array.size; i++) {
+		const msgpack_object& update{ batch.via.array.ptr[i] };
+		if (update.type != MSGPACK_OBJECT_ARRAY
+			|| update.via.array.size < 1
+			|| !MsgpackStringView::isString(update.via.array.ptr[0])) {
+			qWarning() << "Received unexpected redraw operation" << update;
+			continue;
+		}
+
+		const MsgpackStringView name{ MsgpackStringView::fromObject(update.via.array.ptr[0]) };
+		QVariantList residualUpdate;
+
+		for (uint32_t j=1; j<update.via.array.size; j++) {
+			const msgpack_object& args{ update.via.array.ptr[j] };
+			if (args.type != MSGPACK_OBJECT_ARRAY) {
+				qWarning() << "Received unexpected redraw arguments, expecting list" << args;
+				continue;
+			}
+
+			if (dispatchTypedRedrawEvent(*m_redrawHandler, name, args)) {
+				continue;
+			}
+
+			QVariant val;
+			if (decodeMsgpack(args, val)) {
+				qWarning() << "Unable to unpack redraw arguments" << args;
+				continue;
+			}
+
+			if (residualUpdate.isEmpty()) {
+				residualUpdate.append(name.toByteArray());
+			}
+
+			const QVariantList opargs{ val.toList() };
+			m_redrawHandler->handleRedrawEvent(residualUpdate.first().toByteArray(), opargs);
+			residualUpdate.append(QVariant{ opargs });
+		}
+
+		if (!residualUpdate.isEmpty()) {
+			residual.append(QVariant{ residualUpdate });
+		}
+	}
+
+	if (!residual.isEmpty()) {
+		emit notification("redraw", residual);
+	}
+}
+
 /**
  * Sets latest error code and message for this connector
  */
@@ -452,13 +820,125 @@ MsgpackRequest* MsgpackIODevice::startRequestUnchecked(const QString& method, qu
 	msgpack_pack_bin_body(&m_pk, utf8.constData(), utf8.size());
 	msgpack_pack_array(&m_pk, argcount);
 
-	MsgpackRequest *r = new MsgpackRequest( msgid, this);
-	connect(r, &MsgpackRequest::timeout,
-			this, &MsgpackIODevice::requestTimeout);
+	MsgpackRequest *r = acquireRequest(msgid);
 	m_requests.insert(msgid, r);
 	return r;
 }
 
+/**
+ * Take a request object from the pool, or create one if the pool is empty
+ */
+MsgpackRequest* MsgpackIODevice::acquireRequest(quint32 msgid)
+{
+	if (m_requestPool.isEmpty()) {
+		return new MsgpackRequest(msgid, this, this);
+	}
+
+	MsgpackRequest *r = m_requestPool.takeLast();
+	r->id = msgid;
+	return r;
+}
+
+/**
+ * Return a request that is no longer pending to the pool, all its
+ * connections are removed
+ */
+void MsgpackIODevice::releaseRequest(MsgpackRequest *r)
+{
+	clearRequestTimeout(r);
+	r->disconnect();
+	r->m_function = 0;
+	r->m_decoder = nullptr;
+
+	if (m_requestPool.size() < c_requestPoolMax) {
+		m_requestPool.append(r);
+	} else {
+		r->deleteLater();
+	}
+}
+
+/**
+ * Start a msgpack-rpc notification for an API function, Neovim calls the
+ * function but sends no response. Use this for calls whose result is
+ * ignored, errors are reported by Neovim with an nvim_error_event
+ * notification.
+ *
+ * Use send() to pass on each of the call parameters
+ */
+void MsgpackIODevice::startNotificationUnchecked(const QByteArray& method, quint32 argcount)
+{
+	// [type(2), method, args]
+	msgpack_pack_array(&m_pk, 3);
+	msgpack_pack_int(&m_pk, 2);
+	msgpack_pack_bin(&m_pk, method.size());
+	msgpack_pack_bin_body(&m_pk, method.constData(), method.size());
+	msgpack_pack_array(&m_pk, argcount);
+}
+
+/**
+ * Schedule a timeout for a pending request.
+ *
+ * All requests share a single timer, set to the earliest deadline. The
+ * deadline is removed once the request finishes.
+ */
+void MsgpackIODevice::setRequestTimeout(MsgpackRequest *r, int msec)
+{
+	clearRequestTimeout(r);
+	r->m_deadline = m_clock.elapsed() + msec;
+	const bool earliest = m_deadlines.empty() || r->m_deadline < m_deadlines.begin()->first;
+	m_deadlines.insert(std::make_pair(r->m_deadline, r->id));
+
+	if (earliest) {
+		m_timeoutTimer.start(msec);
+	}
+}
+
+/**
+ * Remove the deadline of a request, if any
+ */
+void MsgpackIODevice::clearRequestTimeout(MsgpackRequest *r)
+{
+	if (r->m_deadline < 0) {
+		return;
+	}
+
+	auto range = m_deadlines.equal_range(r->m_deadline);
+	for (auto it = range.first; it != range.second; ++it) {
+		if (it->second == r->id) {
+			m_deadlines.erase(it);
+			break;
+		}
+	}
+	r->m_deadline = -1;
+
+	if (m_deadlines.empty()) {
+		m_timeoutTimer.stop();
+	}
+}
+
+/**
+ * Emit MsgpackRequest::timeout for every request past its deadline
+ */
+void MsgpackIODevice::expireRequests()
+{
+	const qint64 now = m_clock.elapsed();
+	while (!m_deadlines.empty() && m_deadlines.begin()->first <= now) {
+		const quint32 id = m_deadlines.begin()->second;
+		m_deadlines.erase(m_deadlines.begin());
+
+		MsgpackRequest *r = m_requests.value(id);
+		if (r) {
+			r->m_deadline = -1;
+			emit r->timeout(id);
+			requestTimeout(id);
+		}
+	}
+
+	if (!m_deadlines.empty()) {
+		m_timeoutTimer.start(static_cast<int>(m_deadlines.begin()->first - now));
+	}
+}
+
 /**
  * Request timed out, discard it
  */
@@ -466,8 +946,8 @@ void MsgpackIODevice::requestTimeout(quint32 id)
 {
 	if (m_requests.contains(id)) {
 		MsgpackRequest *r = m_requests.take(id);
-		r->deleteLater();
 		qWarning() << "Request" << id << "timed out:"  << r->function();
+		releaseRequest(r);
 	}
 }
 
@@ -483,15 +963,32 @@ void MsgpackIODevice::send(int64_t i)
 {
 	msgpack_pack_int64(&m_pk, i);
 }
+/**
+ * Integers can also be Neovim EXT types (Buffer, Window, Tabpage), these
+ * are decoded using the registered EXT decoders.
+ */
 bool MsgpackIODevice::decodeMsgpack(const msgpack_object& in, int64_t& out)
 {
-	if ( in.type != MSGPACK_OBJECT_POSITIVE_INTEGER) {
-		qWarning() << "Attempting to decode as int64_t when type is" << in.type << in;
-		out = -1;
-		return true;
+	switch (in.type) {
+	case MSGPACK_OBJECT_POSITIVE_INTEGER:
+	case MSGPACK_OBJECT_NEGATIVE_INTEGER:
+		out = in.via.i64;
+		return false;
+	case MSGPACK_OBJECT_EXT:
+		if (m_extTypes.contains(in.via.ext.type)) {
+			const QVariant val = m_extTypes.value(in.via.ext.type)(this, in.via.ext.ptr, in.via.ext.size);
+			if (val.isValid()) {
+				out = val.toLongLong();
+				return false;
+			}
+		}
+		break;
+	default:
+		break;
 	}
-	out = in.via.i64;
-	return false;
+	qWarning() << "Attempting to decode as int64_t when type is" << in.type << in;
+	out = -1;
+	return true;
 }
 
 void MsgpackIODevice::send(double d)
@@ -570,6 +1067,7 @@ bool MsgpackIODevice::decodeMsgpack(const msgpack_object& in, QList<QByteArray>&
 		return true;
 	}
 
+	out.reserve(in.via.array.size);
 	for (uint64_t i=0; i<in.via.array.size; i++) {
 		QByteArray val;
 		if (decodeMsgpack(in.via.array.ptr[i], val)) {
@@ -589,6 +1087,7 @@ bool MsgpackIODevice::decodeMsgpack(const msgpack_object& in, QList<int64_t>& ou
 		return true;
 	}
 
+	out.reserve(in.via.array.size);
 	for (uint64_t i=0; i<in.via.array.size; i++) {
 		int64_t val;
 		if (decodeMsgpack(in.via.array.ptr[i], val)) {
@@ -608,6 +1107,7 @@ bool MsgpackIODevice::decodeMsgpack(const msgpack_object& in, QList<double>& out
 		return true;
 	}
 
+	out.reserve(in.via.array.size);
 	for (uint64_t i=0; i<in.via.array.size; i++) {
 		double val;
 		if (decodeMsgpack(in.via.array.ptr[i], val)) {
@@ -654,18 +1154,11 @@ bool MsgpackIODevice::decodeMsgpack(const msgpack_object& in, QVariant& out)
 		}
 		break;
 	case MSGPACK_OBJECT_ARRAY:
-		// Either a QVariantList or a QStringList
 		{
 		QVariantList ls;
-		for (uint64_t i=0; i<in.via.array.size; i++) {
-			QVariant v;
-			bool failed = decodeMsgpack(in.via.array.ptr[i], v);
-			if (failed) {
-				qWarning() << "Error unpacking Map as QVariantList";
-				out = QVariant();
-				return true;
-			}
-			ls.append(v);
+		if (decodeMsgpack(in, ls)) {
+			out = QVariant();
+			return true;
 		}
 		out = ls;
 		}
@@ -673,20 +1166,9 @@ bool MsgpackIODevice::decodeMsgpack(const msgpack_object& in, QVariant& out)
 	case MSGPACK_OBJECT_MAP:
 		{
 		QVariantMap m;
-		for (uint64_t i=0; i<in.via.map.size; i++) {
-			QByteArray key;
-			if (decodeMsgpack(in.via.map.ptr[i].key, key)) {
-				qWarning() << "Error decoding Object(Map) key";
-				out = QVariant();
-				return true;
-			}
-			QVariant val;
-			if (decodeMsgpack(in.via.map.ptr[i].val, val)) {
-				qWarning() << "Error decoding Object(Map) value";
-				out = QVariant();
-				return true;
-			}
-			m.insert(key,val);
+		if (decodeMsgpack(in, m)) {
+			out = QVariant();
+			return true;
 		}
 		out = m;
 		}
@@ -711,6 +1193,73 @@ bool MsgpackIODevice::decodeMsgpack(const msgpack_object& in, QVariant& out)
 	return false;
 }
 
+bool MsgpackIODevice::decodeMsgpack(const msgpack_object& in, QVariantList& out)
+{
+	out.clear();
+	if ( in.type != MSGPACK_OBJECT_ARRAY) {
+		qWarning() << "Attempting to decode as QVariantList when type is" << in.type << in;
+		return true;
+	}
+
+	out.reserve(in.via.array.size);
+	for (uint64_t i=0; i<in.via.array.size; i++) {
+		QVariant val;
+		if (decodeMsgpack(in.via.array.ptr[i], val)) {
+			qWarning() << "Error unpacking Array as QVariantList";
+			out.clear();
+			return true;
+		}
+		out.append(val);
+	}
+	return false;
+}
+
+bool MsgpackIODevice::decodeMsgpack(const msgpack_object& in, QVariantMap& out)
+{
+	out.clear();
+	if ( in.type != MSGPACK_OBJECT_MAP) {
+		qWarning() << "Attempting to decode as QVariantMap when type is" << in.type << in;
+		return true;
+	}
+
+	for (uint64_t i=0; i<in.via.map.size; i++) {
+		QByteArray key;
+		if (decodeMsgpack(in.via.map.ptr[i].key, key)) {
+			qWarning() << "Error decoding Object(Map) key";
+			out.clear();
+			return true;
+		}
+		QVariant val;
+		if (decodeMsgpack(in.via.map.ptr[i].val, val)) {
+			qWarning() << "Error decoding Object(Map) value";
+			out.clear();
+			return true;
+		}
+		out.insert(key,val);
+	}
+	return false;
+}
+
+bool MsgpackIODevice::decodeMsgpack(const msgpack_object& in, QList<QVariantMap>& out)
+{
+	out.clear();
+	if ( in.type != MSGPACK_OBJECT_ARRAY) {
+		qWarning() << "Attempting to decode as QList<QVariantMap> when type is" << in.type << in;
+		return true;
+	}
+
+	out.reserve(in.via.array.size);
+	for (uint64_t i=0; i<in.via.array.size; i++) {
+		QVariantMap val;
+		if (decodeMsgpack(in.via.array.ptr[i], val)) {
+			out.clear();
+			return true;
+		}
+		out.append(val);
+	}
+	return false;
+}
+
 /**
  * Register a function to decode Msgpack EXT types
  *
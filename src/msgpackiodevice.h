@@ -1,13 +1,19 @@
 #ifndef NEOVIM_QT_MSGPACKIODEVICE
 #define NEOVIM_QT_MSGPACKIODEVICE
 
+#include <map>
 #include <msgpack.h>
+#include <QElapsedTimer>
 #include <QHash>
 #include <QIODevice>
+#include <QTimer>
 #include <QVariant>
+#include <QVector>
 
 namespace NeovimQt {
 
+class MsgpackParser;
+class MsgpackRedrawHandler;
 class MsgpackRequest;
 class MsgpackRequestHandler;
 class MsgpackIODevice: public QObject
@@ -28,6 +34,7 @@ public:
         static MsgpackIODevice* fromStdinOut(QObject *parent=0);
 
 	bool isOpen();
+	bool startParserThread();
 	QString errorString() const;
 	MsgpackError errorCause() const {return m_error;};
 
@@ -35,6 +42,8 @@ public:
 
 	quint32 msgId();
 	MsgpackRequest* startRequestUnchecked(const QString& method, quint32 argcount);
+	void startNotificationUnchecked(const QByteArray& method, quint32 argcount);
+	void setRequestTimeout(MsgpackRequest *r, int msec);
 
 	void send(int64_t);
 	void send(double);
@@ -60,12 +69,32 @@ public:
 	bool sendNotification(const QByteArray& method, const QVariantList& params);
 
 	void setRequestHandler(MsgpackRequestHandler *);
+	void setRedrawHandler(MsgpackRedrawHandler *);
+	MsgpackRedrawHandler* redrawHandler() const noexcept { return m_redrawHandler; }
 
 	/** Typedef for msgpack-to-Qvariant decoder @see registerExtType */
 	typedef QVariant (*msgpackExtDecoder)(MsgpackIODevice*, const char* data, quint32 size);
 	void registerExtType(int8_t type, msgpackExtDecoder);
 
 	QList<quint32> pendingRequests() const;
+
+	/** Decode msgpack objects into native types, these return true on error */
+	bool decodeMsgpack(const msgpack_object& in, int64_t& out);
+	bool decodeMsgpack(const msgpack_object& in, double& out);
+	bool decodeMsgpack(const msgpack_object& in, QVariant& out);
+	bool decodeMsgpack(const msgpack_object& in, QByteArray& out);
+	bool decodeMsgpack(const msgpack_object& in, bool& out);
+	bool decodeMsgpack(const msgpack_object& in, QList<QByteArray>& out);
+	bool decodeMsgpack(const msgpack_object& in, QList<int64_t>& out);
+	bool decodeMsgpack(const msgpack_object& in, QList<double>& out);
+	bool decodeMsgpack(const msgpack_object& in, QPoint& out);
+	bool decodeMsgpack(const msgpack_object& in, QVariantList& out);
+	bool decodeMsgpack(const msgpack_object& in, QVariantMap& out);
+	bool decodeMsgpack(const msgpack_object& in, QList<QVariantMap>& out);
+
+public slots:
+	void flushWriteBuffer();
+
 signals:
 	void error(NeovimQt::MsgpackIODevice::MsgpackError);
 	/** A notification with the given name and arguments was received */
@@ -80,16 +109,14 @@ protected:
 	void dispatchRequest(msgpack_object& obj);
 	void dispatchResponse(msgpack_object& obj);
 	void dispatchNotification(msgpack_object& obj);
-
-	bool decodeMsgpack(const msgpack_object& in, int64_t& out);
-	bool decodeMsgpack(const msgpack_object& in, double& out);
-	bool decodeMsgpack(const msgpack_object& in, QVariant& out);
-	bool decodeMsgpack(const msgpack_object& in, QByteArray& out);
-	bool decodeMsgpack(const msgpack_object& in, bool& out);
-	bool decodeMsgpack(const msgpack_object& in, QList<QByteArray>& out);
-	bool decodeMsgpack(const msgpack_object& in, QList<int64_t>& out);
-	bool decodeMsgpack(const msgpack_object& in, QList<double>& out);
-	bool decodeMsgpack(const msgpack_object& in, QPoint& out);
+	void dispatchRedraw(const msgpack_object& batch);
+	bool reserveReadBuffer(size_t size);
+	void dispatchReadBuffer(size_t bytesRead);
+	void adaptReadReserve(size_t bytesRead);
+	void pushParserInput(const QByteArray& data);
+	MsgpackRequest* acquireRequest(quint32 msgid);
+	void releaseRequest(MsgpackRequest *r);
+	void clearRequestTimeout(MsgpackRequest *r);
 
 protected slots:
 	void setError(NeovimQt::MsgpackIODevice::MsgpackError err, const QString& msg);
@@ -97,19 +124,42 @@ protected slots:
 	void dataAvailable();
 	void dataAvailableStdin(const QByteArray&);
 	void dataAvailableFd(int fd);
+	void inputClosed();
+	void dispatchParsed();
 
 	void requestTimeout(quint32 id);
+	void expireRequests();
 
 private:
-	static int msgpack_write_to_stdout(void* data, const char* buf, unsigned long int len);
-	static int msgpack_write_to_dev(void* data, const char* buf, unsigned long int len);
+	static int msgpack_write_to_buffer(void* data, const char* buf, unsigned long int len);
+
+	/// Outgoing data is written immediately once the buffer reaches this size
+	static constexpr int c_writeBufferFlushSize{ 64 * 1024 };
+
+	/// Bounds for the adaptive read size
+	static constexpr size_t c_readReserveMin{ 8 * 1024 };
+	static constexpr size_t c_readReserveMax{ 4 * 1024 * 1024 };
+
+	/// Finished requests kept for reuse
+	static constexpr int c_requestPoolMax{ 64 };
 
 	quint32 m_reqid;
 	QIODevice* m_dev;
 	msgpack_packer m_pk;
 	msgpack_unpacker m_uk;
+	QByteArray m_writeBuffer;
+	bool m_writeScheduled{ false };
+	size_t m_readReserve{ c_readReserveMin };
+	MsgpackParser* m_parser{ nullptr };
+	QByteArray m_parserInput;
 	QHash<quint32, MsgpackRequest*> m_requests;
+	QVector<MsgpackRequest*> m_requestPool;
+	/// Request deadlines in ms since m_clock started, mapped to request ids
+	std::multimap<qint64, quint32> m_deadlines;
+	QElapsedTimer m_clock;
+	QTimer m_timeoutTimer;
 	MsgpackRequestHandler *m_reqHandler;
+	MsgpackRedrawHandler *m_redrawHandler{ nullptr };
 	QHash<int8_t, msgpackExtDecoder> m_extTypes;
 
 	QString m_errorString;
@@ -0,0 +1,167 @@
+#include "msgpackparser.h"
+
+#include <QDebug>
+
+namespace NeovimQt {
+
+/**
+ * \class NeovimQt::MsgpackParser
+ *
+ * \brief Unpacks msgpack data in a background thread
+ *
+ * Raw data is passed in with push() from the thread that owns the parser,
+ * complete messages are handed back through pop(). Both directions use a
+ * lock-free single-producer/single-consumer queue, the semaphores are only
+ * used to put the worker to sleep when it has nothing to do.
+ *
+ * The object trees live in their own msgpack zone and are immutable, the
+ * receiver frees each zone once the message has been dispatched. Messages
+ * that lie entirely within one input chunk are unpacked in place and keep
+ * the chunk alive, only a message split across chunks is copied into the
+ * streaming unpacker.
+ */
+
+static constexpr size_t c_inputCapacity{ 256 };
+static constexpr size_t c_outputCapacity{ 4096 };
+
+MsgpackParser::MsgpackParser(QObject *parent)
+:QThread(parent), m_input(c_inputCapacity), m_output(c_outputCapacity),
+	m_outputSpace(c_outputCapacity)
+{
+	msgpack_unpacker_init(&m_uk, MSGPACK_UNPACKER_INIT_BUFFER_SIZE);
+}
+
+MsgpackParser::~MsgpackParser()
+{
+	stop();
+
+	Message msg;
+	while (pop(msg)) {
+		msgpack_zone_free(msg.zone);
+	}
+	msgpack_unpacker_destroy(&m_uk);
+}
+
+/**
+ * Queue raw data for parsing. Returns false if the input queue is full,
+ * in that case push the data again after taking parsed messages.
+ */
+bool MsgpackParser::push(const QByteArray& data)
+{
+	if (!m_input.push(data)) {
+		return false;
+	}
+	m_inputCount.release();
+	return true;
+}
+
+/**
+ * Take the next parsed message, returns false if there are none. The
+ * caller owns msg.zone and must free it with msgpack_zone_free().
+ */
+bool MsgpackParser::pop(Message& msg)
+{
+	if (!m_output.pop(msg)) {
+		return false;
+	}
+	m_outputSpace.release();
+	return true;
+}
+
+/**
+ * Call before taking messages, messagesAvailable() is emitted again for
+ * any message parsed after this call.
+ */
+void MsgpackParser::clearNotification()
+{
+	m_notified = false;
+}
+
+void MsgpackParser::stop()
+{
+	m_stopped = true;
+	m_inputCount.release();
+	m_outputSpace.release();
+	wait();
+}
+
+/**
+ * True while the streaming unpacker holds part of a message
+ */
+bool MsgpackParser::isStreaming() const noexcept
+{
+	return msgpack_unpacker_parsed_size(&m_uk) != 0
+		|| msgpack_unpacker_nonparsed_size(&m_uk) != 0;
+}
+
+/**
+ * Hand a message to the receiver, blocks while the receiver is behind.
+ * Returns false if the parser was stopped, the message is discarded.
+ */
+bool MsgpackParser::output(const Message& msg)
+{
+	m_outputSpace.acquire();
+	if (m_stopped) {
+		msgpack_zone_free(msg.zone);
+		return false;
+	}
+
+	m_output.push(msg);
+	if (!m_notified.exchange(true)) {
+		emit messagesAvailable();
+	}
+	return true;
+}
+
+void MsgpackParser::run()
+{
+	msgpack_unpacked result;
+	msgpack_unpacked_init(&result);
+
+	bool running{ true };
+	while (running) {
+		m_inputCount.acquire();
+		QByteArray data;
+		if (m_stopped || !m_input.pop(data)) {
+			break;
+		}
+
+		const size_t size{ static_cast<size_t>(data.size()) };
+		size_t off{ 0 };
+		while (running && off < size && !isStreaming()) {
+			const size_t begin{ off };
+			const msgpack_unpack_return ret{
+				msgpack_unpack_next(&result, data.constData(), size, &off) };
+			if (ret == MSGPACK_UNPACK_SUCCESS) {
+				running = output({ result.data, msgpack_unpacked_release_zone(&result), data });
+			} else if (ret == MSGPACK_UNPACK_CONTINUE) {
+				// The message continues in the next chunk
+				off = begin;
+				break;
+			} else {
+				qWarning() << "Error unpacking msgpack data, dropping" << size - begin << "bytes";
+				off = size;
+			}
+		}
+
+		const size_t rest{ size - off };
+		if (!running || rest == 0) {
+			continue;
+		}
+
+		if (!msgpack_unpacker_reserve_buffer(&m_uk, rest)) {
+			qFatal("Could not allocate memory in unpack buffer");
+			break;
+		}
+		memcpy(msgpack_unpacker_buffer(&m_uk), data.constData() + off, rest);
+		msgpack_unpacker_buffer_consumed(&m_uk, rest);
+
+		while (running && msgpack_unpacker_next(&m_uk, &result)) {
+			running = output({ result.data, msgpack_unpacked_release_zone(&result), QByteArray() });
+		}
+	}
+
+	msgpack_unpacked_destroy(&result);
+}
+
+} // Namespace NeovimQt
@@ -0,0 +1,56 @@
+#ifndef NEOVIM_QT_MSGPACKPARSER
+#define NEOVIM_QT_MSGPACKPARSER
+
+#include <atomic>
+#include <msgpack.h>
+#include <QByteArray>
+#include <QSemaphore>
+#include <QThread>
+
+#include "spscqueue.h"
+
+namespace NeovimQt {
+
+class MsgpackParser: public QThread
+{
+	Q_OBJECT
+public:
+	/// A parsed message, the object tree is owned by zone. Strings may
+	/// point into buffer, the input chunk the message was unpacked from.
+	struct Message
+	{
+		msgpack_object data;
+		msgpack_zone* zone;
+		QByteArray buffer;
+	};
+
+	MsgpackParser(QObject *parent=0);
+	~MsgpackParser();
+
+	bool push(const QByteArray& data);
+	bool pop(Message& msg);
+	void clearNotification();
+
+signals:
+	/// Parsed messages can be taken with pop()
+	void messagesAvailable();
+
+protected:
+	virtual void run();
+
+private:
+	void stop();
+	bool isStreaming() const noexcept;
+	bool output(const Message& msg);
+
+	msgpack_unpacker m_uk;
+	SpscQueue<QByteArray> m_input;
+	SpscQueue<Message> m_output;
+	QSemaphore m_inputCount;
+	QSemaphore m_outputSpace;
+	std::atomic<bool> m_notified{ false };
+	std::atomic<bool> m_stopped{ false };
+};
+
+} // Namespace NeovimQt
+#endif
@@ -0,0 +1,53 @@
+#include "msgpackredraw.h"
+
+namespace NeovimQt {
+
+/**
+ * \class NeovimQt::MsgpackRedrawHandler
+ *
+ * \brief Typed receiver for Neovim redraw notifications
+ *
+ * \see NeovimQt::MsgpackIODevice::setRedrawHandler
+ */
+
+bool GridLineCellSpan::isValid() const noexcept
+{
+	for (uint32_t i=0; i<m_size; i++) {
+		const msgpack_object& cell{ m_cells[i] };
+		if (cell.type != MSGPACK_OBJECT_ARRAY
+			|| cell.via.array.size < 1
+			|| cell.via.array.size > 3
+			|| !MsgpackStringView::isString(cell.via.array.ptr[0])) {
+			return false;
+		}
+
+		if (cell.via.array.size > 1 && !isUnsignedInteger(cell.via.array.ptr[1])) {
+			return false;
+		}
+
+		if (cell.via.array.size > 2 && !isUnsignedInteger(cell.via.array.ptr[2])) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*static*/ GridLineCell GridLineCellSpan::decodeCell(const msgpack_object& cell) noexcept
+{
+	GridLineCell out;
+	out.text = MsgpackStringView::fromObject(cell.via.array.ptr[0]);
+
+	if (cell.via.array.size > 1) {
+		out.hasHighlightId = true;
+		out.highlightId = cell.via.array.ptr[1].via.u64;
+	}
+
+	if (cell.via.array.size > 2) {
+		out.repeat = cell.via.array.ptr[2].via.u64;
+	}
+
+	return out;
+}
+
+} // Namespace NeovimQt
@@ -0,0 +1,156 @@
+#ifndef NEOVIM_QT_MSGPACKREDRAW
+#define NEOVIM_QT_MSGPACKREDRAW
+
+#include <cstring>
+#include <msgpack.h>
+#include <QByteArray>
+#include <QVariantList>
+
+namespace NeovimQt {
+
+/**
+ * A non-owning view of a msgpack STR/BIN object. The data points into the
+ * unpacker zone and is only valid while the redraw batch is being dispatched.
+ */
+class MsgpackStringView
+{
+public:
+	MsgpackStringView() noexcept = default;
+	MsgpackStringView(const char* data, uint32_t size) noexcept
+		: m_data{ data }
+		, m_size{ size }
+	{
+	}
+
+	const char* data() const noexcept { return m_data; }
+	uint32_t size() const noexcept { return m_size; }
+	bool isEmpty() const noexcept { return m_size == 0; }
+
+	/// Deep copy, use this if the string must outlive the redraw batch
+	QByteArray toByteArray() const { return QByteArray(m_data, m_size); }
+
+	/// Returns true if the view can be built from this object
+	static bool isString(const msgpack_object& obj) noexcept
+	{
+		return obj.type == MSGPACK_OBJECT_STR || obj.type == MSGPACK_OBJECT_BIN;
+	}
+
+	static MsgpackStringView fromObject(const msgpack_object& obj) noexcept
+	{
+		if (obj.type == MSGPACK_OBJECT_STR) {
+			return { obj.via.str.ptr, obj.via.str.size };
+		}
+		if (obj.type == MSGPACK_OBJECT_BIN) {
+			return { obj.via.bin.ptr, obj.via.bin.size };
+		}
+		return {};
+	}
+
+	bool operator==(const char* other) const noexcept
+	{
+		return qstrlen(other) == m_size
+			&& (m_size == 0 || memcmp(m_data, other, m_size) == 0);
+	}
+
+private:
+	const char* m_data{ nullptr };
+	uint32_t m_size{ 0 };
+};
+
+/// Returns true for non-negative msgpack integers, e.g. grid ids and positions
+inline bool isUnsignedInteger(const msgpack_object& obj) noexcept
+{
+	return obj.type == MSGPACK_OBJECT_POSITIVE_INTEGER;
+}
+
+/// A single grid_line cell: [text, hl_id, repeat], hl_id and repeat are optional
+struct GridLineCell
+{
+	MsgpackStringView text;
+
+	/// When false the cell reuses the highlight of the previous cell
+	bool hasHighlightId{ false };
+	uint64_t highlightId{ 0 };
+
+	uint64_t repeat{ 1 };
+};
+
+/**
+ * A non-owning view over the cells array of a grid_line event.
+ *
+ * Cells are decoded lazily while iterating, the span must be validated
+ * with isValid() before iteration.
+ */
+class GridLineCellSpan
+{
+public:
+	class const_iterator
+	{
+	public:
+		const_iterator(const msgpack_object* pos) noexcept : m_pos{ pos } {}
+
+		GridLineCell operator*() const noexcept { return GridLineCellSpan::decodeCell(*m_pos); }
+		const_iterator& operator++() noexcept { ++m_pos; return *this; }
+		bool operator!=(const const_iterator& other) const noexcept { return m_pos != other.m_pos; }
+
+	private:
+		const msgpack_object* m_pos;
+	};
+
+	GridLineCellSpan() noexcept = default;
+	GridLineCellSpan(const msgpack_object* cells, uint32_t size) noexcept
+		: m_cells{ cells }
+		, m_size{ size }
+	{
+	}
+
+	uint32_t size() const noexcept { return m_size; }
+	const_iterator begin() const noexcept { return { m_cells }; }
+	const_iterator end() const noexcept { return { m_cells + m_size }; }
+
+	/// Check every cell in the span has the expected format
+	bool isValid() const noexcept;
+
+	static GridLineCell decodeCell(const msgpack_object& cell) noexcept;
+
+private:
+	const msgpack_object* m_cells{ nullptr };
+	uint32_t m_size{ 0 };
+};
+
+/// ["grid_line", grid, row, col_start, cells]
+struct GridLineEvent
+{
+	uint64_t grid{ 0 };
+	uint64_t row{ 0 };
+	uint64_t colStart{ 0 };
+	GridLineCellSpan cells;
+};
+
+/**
+ * Receives the contents of redraw notifications without building a QVariant
+ * tree for the whole batch.
+ *
+ * The high volume 'ext_linegrid' events are delivered as typed, non-owning
+ * views. All other events are decoded individually and delivered through
+ * handleRedrawEvent(), in the order they were received.
+ *
+ * @see MsgpackIODevice::setRedrawHandler
+ */
+class MsgpackRedrawHandler
+{
+public:
+	virtual ~MsgpackRedrawHandler() = default;
+
+	virtual void handleGridLine(const GridLineEvent& ev) = 0;
+	virtual void handleGridCursorGoto(uint64_t grid, uint64_t row, uint64_t col) = 0;
+	virtual void handleGridClear(uint64_t grid) = 0;
+	virtual void handleFlush() = 0;
+
+	/// Any other redraw event, a single argument tuple for event `name`
+	virtual void handleRedrawEvent(const QByteArray& name, const QVariantList& args) = 0;
+};
+
+} // Namespace NeovimQt
+
+#endif
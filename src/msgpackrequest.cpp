@@ -7,6 +7,10 @@ namespace NeovimQt {
  * \class NeovimQt::MsgpackRequest
  *
  * \brief A MsgpackRequest represents an ongoing API call
+ *
+ * Requests are owned by their MsgpackIODevice. Once a request finishes,
+ * fails or times out its connections are removed and the object may be
+ * reused for a later call, do not keep pointers to finished requests.
  */
 
 /**
@@ -23,8 +27,6 @@ namespace NeovimQt {
 MsgpackRequest::MsgpackRequest(quint32 id, MsgpackIODevice *dev, QObject *parent)
 :QObject(parent), id(id), m_dev(dev), m_function(0)
 {
-	connect(&m_timer, &QTimer::timeout,
-		this, &MsgpackRequest::requestTimeout);
 }
 
 /**
@@ -46,16 +48,29 @@ void MsgpackRequest::setFunction(quint64 f)
 	m_function = f;
 }
 
+/**
+ * Emit timeout() if no response arrives within msec milliseconds
+ *
+ * \see MsgpackIODevice::setRequestTimeout
+ */
 void MsgpackRequest::setTimeout(int msec)
 {
-	m_timer.setInterval(msec);
-	m_timer.setSingleShot(true);
-	m_timer.start();
+	m_dev->setRequestTimeout(this, msec);
 }
 
-void MsgpackRequest::requestTimeout()
+/**
+ * Decode the result of a successful response with the given function
+ *
+ * The decoder is called with the raw msgpack object, before it is converted
+ * into a QVariant. When a decoder is set the result is not converted at all,
+ * and finished() is emitted with an invalid QVariant once the decoder returns.
+ * If the decoder returns true the result could not be decoded, and error()
+ * is emitted instead of finished(). Error responses are still delivered
+ * through error().
+ */
+void MsgpackRequest::setResultDecoder(const ResultDecoder& decoder)
 {
-	emit timeout(this->id);
+	m_decoder = decoder;
 }
 
 } // namespace NeovimQt
@@ -1,32 +1,38 @@
 #ifndef NEOVIM_QT_REQUEST
 #define NEOVIM_QT_REQUEST
 
+#include <functional>
+#include <msgpack.h>
 #include <QObject>
-#include <QTimer>
 
 namespace NeovimQt {
 
 class MsgpackIODevice;
 class MsgpackRequest: public QObject {
 	Q_OBJECT
+	friend class MsgpackIODevice;
 public:
+	/** Decodes a successful response in place, returns true on error, @see setResultDecoder */
+	typedef std::function<bool(MsgpackIODevice*, const msgpack_object&)> ResultDecoder;
+
 	MsgpackRequest(quint32 id, MsgpackIODevice *dev, QObject *parent=0);
 	void setFunction(quint64);
 	quint64 function();
 	void setTimeout(int msec);
-	/** The identifier for this Msgpack request */
-	const quint32 id;
+	void setResultDecoder(const ResultDecoder& decoder);
+	/** The identifier for this Msgpack request, changes when the request is reused */
+	quint32 id;
 signals:
 	void finished(quint32 msgid, quint64 fun, const QVariant& resp);
 	void error(quint32 msgid, quint64 fun, const QVariant& err);
 	void timeout(quint32 id);
-protected slots:
-	void requestTimeout();
 
 private:
 	MsgpackIODevice *m_dev;
 	quint64 m_function;
-	QTimer m_timer;
+	ResultDecoder m_decoder;
+	/** Set by MsgpackIODevice::setRequestTimeout */
+	qint64 m_deadline{ -1 };
 };
 } // Namespace
 
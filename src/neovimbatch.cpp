@@ -0,0 +1,184 @@
+#include "neovimbatch.h"
+
+#include <QDebug>
+
+#include "msgpackiodevice.h"
+#include "msgpackrequest.h"
+#include "neovimconnector.h"
+
+namespace NeovimQt {
+
+/**
+ * \class NeovimQt::NeovimBatch
+ *
+ * \brief A list of API calls submitted as a single request
+ *
+ * Calls are collected with call() and sent with submit() as one
+ * nvim_call_atomic request, a single round trip instead of one per call.
+ * Neovim runs the calls in order and stops at the first error.
+ *
+ * If Neovim does not support nvim_call_atomic the calls are sent as
+ * individual requests, the results are still reported through finished()
+ * or error().
+ *
+ * The batch deletes itself after it has completed.
+ *
+ * \see NeovimConnector::startBatch
+ */
+
+NeovimBatch::NeovimBatch(NeovimConnector *c)
+:QObject(c), m_c(c)
+{
+}
+
+/**
+ * Add a call to the batch, returns the index of its result
+ */
+int NeovimBatch::call(const QByteArray& method, const QVariantList& args)
+{
+	if (m_submitted) {
+		qWarning() << "Adding call" << method << "to a submitted batch";
+		return -1;
+	}
+
+	m_calls.append(QVariant{ QVariantList{ method, QVariant{ args } } });
+	return m_calls.size() - 1;
+}
+
+/**
+ * Fail the batch with error() if Neovim does not reply within msec
+ * milliseconds. Must be called before submit().
+ */
+void NeovimBatch::setTimeout(int msec)
+{
+	m_timeout = msec;
+}
+
+/**
+ * Send all calls, finished() or error() is emitted once Neovim has replied
+ */
+void NeovimBatch::submit()
+{
+	if (m_submitted) {
+		return;
+	}
+	m_submitted = true;
+
+	if (m_calls.isEmpty()) {
+		emit finished({});
+		deleteLater();
+		return;
+	}
+
+	if (!m_c->api1()) {
+		submitSequential();
+		return;
+	}
+
+	MsgpackRequest *r = m_c->api1()->nvim_call_atomic(m_calls);
+	connect(r, &MsgpackRequest::finished, this, &NeovimBatch::handleAtomicResponse);
+	connect(r, &MsgpackRequest::error, this, &NeovimBatch::handleAtomicError);
+	connect(r, &MsgpackRequest::timeout, this, &NeovimBatch::handleAtomicTimeout);
+	if (m_timeout >= 0) {
+		r->setTimeout(m_timeout);
+	}
+}
+
+/**
+ * nvim_call_atomic returns [results, error], error is nil or
+ * [index, type, message]
+ */
+void NeovimBatch::handleAtomicResponse(quint32, quint64, const QVariant& resp)
+{
+	const QVariantList response{ resp.toList() };
+	if (response.size() != 2
+		|| static_cast<QMetaType::Type>(response.at(0).type()) != QMetaType::QVariantList) {
+		qWarning() << "Unexpected response for nvim_call_atomic:" << resp;
+		emit error(0, resp, {});
+		deleteLater();
+		return;
+	}
+
+	const QVariantList results{ response.at(0).toList() };
+	if (response.at(1).isNull()) {
+		emit finished(results);
+	} else {
+		const QVariantList err{ response.at(1).toList() };
+		const int index{ err.isEmpty() ? 0 : err.at(0).toInt() };
+		emit error(index, response.at(1), results);
+	}
+	deleteLater();
+}
+
+void NeovimBatch::handleAtomicError(quint32, quint64, const QVariant& err)
+{
+	emit error(0, err, {});
+	deleteLater();
+}
+
+void NeovimBatch::handleAtomicTimeout(quint32)
+{
+	emit error(0, QStringLiteral("Request timed out"), {});
+	deleteLater();
+}
+
+/**
+ * Fallback for Neovim instances without nvim_call_atomic. All requests are
+ * still written before any response arrives.
+ */
+void NeovimBatch::submitSequential()
+{
+	MsgpackIODevice *dev = m_c->m_dev;
+	m_pending = m_calls.size();
+
+	for (int i=0; i<m_calls.size(); i++) {
+		m_results.append(QVariant());
+
+		const QVariantList call{ m_calls.at(i).toList() };
+		const QVariantList args{ call.at(1).toList() };
+
+		MsgpackRequest *r = dev->startRequestUnchecked(call.at(0).toString(), args.size());
+		for (const QVariant& arg : args) {
+			dev->send(arg);
+		}
+
+		connect(r, &MsgpackRequest::finished, this,
+			[this, i](quint32, quint64, const QVariant& resp) { handleSequentialResponse(i, resp); });
+		connect(r, &MsgpackRequest::error, this,
+			[this, i](quint32, quint64, const QVariant& err) { handleSequentialError(i, err); });
+		connect(r, &MsgpackRequest::timeout, this,
+			[this, i](quint32) { handleSequentialError(i, QStringLiteral("Request timed out")); });
+		if (m_timeout >= 0) {
+			r->setTimeout(m_timeout);
+		}
+	}
+}
+
+void NeovimBatch::handleSequentialResponse(int index, const QVariant& resp)
+{
+	m_results[index] = resp;
+	if (--m_pending > 0) {
+		return;
+	}
+
+	if (!m_failed) {
+		emit finished(m_results);
+	}
+	deleteLater();
+}
+
+void NeovimBatch::handleSequentialError(int index, const QVariant& err)
+{
+	// Unlike nvim_call_atomic the remaining calls still run, only the
+	// results before the first failed call are reported.
+	if (!m_failed) {
+		m_failed = true;
+		emit error(index, err, m_results.mid(0, index));
+	}
+
+	if (--m_pending == 0) {
+		deleteLater();
+	}
+}
+
+} // namespace NeovimQt
@@ -0,0 +1,51 @@
+#ifndef NEOVIM_QT_BATCH
+#define NEOVIM_QT_BATCH
+
+#include <QByteArray>
+#include <QObject>
+#include <QVariantList>
+
+namespace NeovimQt {
+
+class NeovimConnector;
+class NeovimBatch: public QObject
+{
+	Q_OBJECT
+public:
+	NeovimBatch(NeovimConnector *c);
+
+	int call(const QByteArray& method, const QVariantList& args=QVariantList());
+	int count() const { return m_calls.size(); }
+	void setTimeout(int msec);
+	void submit();
+
+signals:
+	/** All calls succeeded, results holds one entry per call */
+	void finished(const QVariantList& results);
+	/**
+	 * The call at index failed. Results holds the results of the calls that
+	 * ran before it, later calls may not have been executed.
+	 */
+	void error(int index, const QVariant& err, const QVariantList& results);
+
+private slots:
+	void handleAtomicResponse(quint32 msgid, quint64 fun, const QVariant& resp);
+	void handleAtomicError(quint32 msgid, quint64 fun, const QVariant& err);
+	void handleAtomicTimeout(quint32 msgid);
+
+private:
+	void submitSequential();
+	void handleSequentialResponse(int index, const QVariant& resp);
+	void handleSequentialError(int index, const QVariant& err);
+
+	NeovimConnector *m_c;
+	QVariantList m_calls;
+	QVariantList m_results;
+	int m_pending{ 0 };
+	int m_timeout{ -1 };
+	bool m_submitted{ false };
+	bool m_failed{ false };
+};
+
+} // namespace NeovimQt
+#endif
@@ -4,15 +4,19 @@
 #include <QLocalSocket>
 #include <QMetaMethod>
 #include <QTcpSocket>
+#include <QTimer>
 #include <QtGlobal>
 
 #include "compat.h"
 #include "msgpackiodevice.h"
 #include "msgpackrequest.h"
+#include "neovimbatch.h"
 #include "neovimconnectorhelper.h"
 
 namespace NeovimQt {
 
+static bool s_metadataCacheEnabled{ false };
+
 /**
  * \class NeovimQt::NeovimConnector
  * 
@@ -108,6 +112,9 @@ QString NeovimConnector::connectionDescription()
 
 /**
  * Returns the channel id used by Neovim to identify this connection
+ *
+ * For spawned connections using cached metadata this is 0 until Neovim
+ * answers the metadata request, @see discoverMetadata
  */
 uint64_t NeovimConnector::channel()
 {
@@ -116,6 +123,10 @@ uint64_t NeovimConnector::channel()
 
 /**
  * Request API information from Neovim
+ *
+ * If metadata for the spawned Neovim binary was cached by an earlier
+ * connection, ready() is emitted without waiting for the response. The
+ * response is still checked, and refreshes the cache.
  */
 void NeovimConnector::discoverMetadata()
 {
@@ -127,6 +138,10 @@ void NeovimConnector::discoverMetadata()
 	connect(r, &MsgpackRequest::timeout,
 			this, &NeovimConnector::fatalTimeout);
 	r->setTimeout(m_timeout);
+
+	if (m_helper->hasCachedMetadata()) {
+		QTimer::singleShot(0, m_helper, &NeovimConnectorHelper::handleCachedMetadata);
+	}
 }
 
 /**
@@ -139,34 +154,34 @@ bool NeovimConnector::isReady()
 }
 
 /**
+ * The API bindings, if Neovim supports the given API level
+ *
+ * All API levels share the same NeovimApi instance, it is created on first
+ * use.
+ *
  * @warning Do not call this before NeovimConnector::ready as been signaled
  * @see NeovimConnector::isReady
  */
-NeovimApi0* NeovimConnector::api0()
+NeovimApi* NeovimConnector::api(quint64 level)
 {
-	if ( !m_api0 ) {
-		if (m_api_compat <= 0) {
-			m_api0 = new NeovimApi0(this);
-		} else {
-			qDebug() << "This instance of neovim DOES NOT support api level 0";
-		}
+	if (level < m_api_compat || m_api_supported < level) {
+		qDebug() << "This instance of neovim DOES NOT support api level" << level;
+		return nullptr;
 	}
-	return m_api0;
+	if (!m_api) {
+		m_api = new NeovimApi(this);
+	}
+	return m_api;
 }
-/**
- * @warning Do not call this before NeovimConnector::ready as been signaled
- * @see NeovimConnector::isReady
- */
+
+NeovimApi0* NeovimConnector::api0()
+{
+	return api(0);
+}
+
 NeovimApi1* NeovimConnector::api1()
 {
-	if ( !m_api1 ) {
-		if (m_api_compat <= 1 && 1 <= m_api_supported) {
-			m_api1 = new NeovimApi1(this);
-		} else {
-			qDebug() << "This instance of neovim DOES NOT support api level 1";
-		}
-	}
-	return m_api1;
+	return api(1);
 }
 
 /** For compatibility with older versions */
@@ -175,84 +190,41 @@ NeovimApi1* NeovimConnector::neovimObject()
 	return api1();
 }
 
-/**
- * @warning Do not call this before NeovimConnector::ready as been signaled
- * @see NeovimConnector::isReady
- */
 NeovimApi2* NeovimConnector::api2()
 {
-	if ( !m_api2 ) {
-		if (m_api_compat <= 2 && 2 <= m_api_supported) {
-			m_api2 = new NeovimApi2(this);
-		} else {
-			qWarning() << "This instance of neovim not support api level 2";
-		}
-	}
-	return m_api2;
+	return api(2);
 }
 
-/**
- * @warning Do not call this before NeovimConnector::ready as been signaled
- * @see NeovimConnector::isReady
- */
 NeovimApi3* NeovimConnector::api3()
 {
-	if ( !m_api3 ) {
-		if (m_api_compat <= 3 && 3 <= m_api_supported) {
-			m_api3 = new NeovimApi3(this);
-		} else {
-			qWarning() << "This instance of neovim not support api level 3";
-		}
-	}
-	return m_api3;
+	return api(3);
 }
 
-/**
- * @warning Do not call this before NeovimConnector::ready as been signaled
- * @see NeovimConnector::isReady
- */
 NeovimApi4* NeovimConnector::api4()
 {
-	if ( !m_api4 ) {
-		if (m_api_compat <= 4 && 4 <= m_api_supported) {
-			m_api4 = new NeovimApi4(this);
-		} else {
-			qWarning() << "This instance of neovim not support api level 4";
-		}
-	}
-	return m_api4;
+	return api(4);
 }
 
-/**
- * @warning Do not call this before NeovimConnector::ready as been signaled
- * @see NeovimConnector::isReady
- */
 NeovimApi5* NeovimConnector::api5()
 {
-	if ( !m_api5 ) {
-		if (m_api_compat <= 5 && 5 <= m_api_supported) {
-			m_api5 = new NeovimApi5(this);
-		} else {
-			qWarning() << "This instance of neovim not support api level 5";
-		}
-	}
-	return m_api5;
+	return api(5);
+}
+
+NeovimApi6* NeovimConnector::api6()
+{
+	return api(6);
 }
 
 /**
- * @warning Do not call this before NeovimConnector::ready as been signaled
- * @see NeovimConnector::isReady
+ * Cache the API metadata of spawned Neovim binaries on disk
+ *
+ * When enabled, a spawned connection whose binary was seen before becomes
+ * ready() before Neovim answers the metadata request. Until then channel()
+ * returns 0. Affects connectors created after this call.
  */
-NeovimApi6* NeovimConnector::api6()
+void NeovimConnector::setMetadataCacheEnabled(bool enabled)
 {
-	if ( !m_api6 ) {
-		if (m_api_compat <= 6 && 6 <= m_api_supported) {
-			m_api6 = new NeovimApi6(this);
-		} else {
-			qWarning() << "This instance of neovim not support api level 6";
-		}
-	}
-	return m_api6;
+	s_metadataCacheEnabled = enabled;
 }
 
 /**
@@ -279,6 +251,9 @@ NeovimConnector* NeovimConnector::spawn(const QStringList& params, const QString
 	c->m_ctype = SpawnedConnection;
 	c->m_spawnArgs = params;
 	c->m_spawnExe = exe;
+	if (s_metadataCacheEnabled) {
+		c->m_helper->loadMetadataCache(exe);
+	}
 
 #if (QT_VERSION < QT_VERSION_CHECK(5, 15, 0))
 	connect(p, SIGNAL(error(QProcess::ProcessError)),
@@ -437,6 +412,53 @@ void NeovimConnector::setRequestHandler(MsgpackRequestHandler *h)
 	m_dev->setRequestHandler(h);
 }
 
+/**
+ * Call an API function as a msgpack-rpc notification, no request is tracked
+ * and Neovim sends no response. Use this for calls whose result is ignored,
+ * e.g. input. Errors are reported by Neovim as "nvim_error_event"
+ * notifications.
+ */
+void NeovimConnector::notify(const QByteArray& method, const QVariantList& args)
+{
+	m_dev->startNotificationUnchecked(method, args.size());
+	for (const QVariant& arg : args) {
+		m_dev->send(arg);
+	}
+}
+
+/**
+ * Start a batch of API calls, submitted as a single nvim_call_atomic
+ * request.
+ *
+ * @see NeovimBatch
+ */
+NeovimBatch* NeovimConnector::startBatch()
+{
+	return new NeovimBatch(this);
+}
+
+/**
+ * Parse incoming msgpack data in a background thread, call this right
+ * after creating the connector. The option carries over to reconnect().
+ *
+ * @see MsgpackIODevice::startParserThread
+ */
+bool NeovimConnector::startParserThread()
+{
+	m_parserThread = m_dev->startParserThread();
+	return m_parserThread;
+}
+
+/**
+ * Set a handler for redraw notifications
+ *
+ * @see MsgpackIODevice::setRedrawHandler
+ */
+void NeovimConnector::setRedrawHandler(MsgpackRedrawHandler *h)
+{
+	m_dev->setRedrawHandler(h);
+}
+
 /**
  * True if NeovimConnector::reconnect can be called to reconnect with Neovim. This
  * is true unless you built the NeovimConnector ctor directly instead
@@ -463,18 +485,25 @@ NeovimConnector::NeovimConnectionType NeovimConnector::connectionType()
  */
 NeovimConnector* NeovimConnector::reconnect()
 {
+	NeovimConnector *c = NULL;
 	switch(m_ctype) {
 	case SpawnedConnection:
-		return NeovimConnector::spawn(m_spawnArgs, m_spawnExe);
+		c = NeovimConnector::spawn(m_spawnArgs, m_spawnExe);
+		break;
 	case HostConnection:
-		return NeovimConnector::connectToHost(m_connHost, m_connPort);
+		c = NeovimConnector::connectToHost(m_connHost, m_connPort);
+		break;
 	case SocketConnection:
-		return NeovimConnector::connectToSocket(m_connSocket);
+		c = NeovimConnector::connectToSocket(m_connSocket);
+		break;
 	default:
 		return NULL;
 	}
-	// NOT-REACHED
-	return NULL;
+
+	if (m_parserThread) {
+		c->startParserThread();
+	}
+	return c;
 }
 
 /** The minimum API level supported by this instance */
@@ -5,30 +5,21 @@
 #include <QObject>
 #include <QProcess>
 
-#include "auto/neovimapi0.h"
-#include "auto/neovimapi1.h"
-#include "auto/neovimapi2.h"
-#include "auto/neovimapi3.h"
-#include "auto/neovimapi4.h"
-#include "auto/neovimapi5.h"
-#include "auto/neovimapi6.h"
+#include "auto/neovimapi.h"
 #include "msgpackiodevice.h"
 
 namespace NeovimQt {
 
 class MsgpackIODevice;
+class MsgpackRedrawHandler;
+class NeovimBatch;
 class MsgpackRequestHandler;
 class NeovimConnectorHelper;
 class NeovimConnector: public QObject
 {
-	friend class NeovimApi0;
-	friend class NeovimApi1;
-	friend class NeovimApi2;
-	friend class NeovimApi3;
-	friend class NeovimApi4;
-	friend class NeovimApi5;
-	friend class NeovimApi6;
+	friend class NeovimApi;
 	friend class NeovimConnectorHelper;
+	friend class NeovimBatch;
 	Q_OBJECT
 	/**
 	 * True if the Neovim instance is ready
@@ -67,6 +58,7 @@ public:
 	static NeovimConnector* connectToHost(const QString& host, int port);
 	static NeovimConnector* connectToNeovim(const QString& server=QString());
 	static NeovimConnector* fromStdinOut();
+	static void setMetadataCacheEnabled(bool enabled);
 
 	bool canReconnect();
 	NeovimConnector* reconnect();
@@ -75,6 +67,7 @@ public:
 	QString errorString();
 
 	bool isReady();
+	NeovimApi * api(quint64 level);
 	NeovimApi0 * api0();
 	NeovimApi1 * neovimObject();
 	NeovimApi1 * api1();
@@ -95,6 +88,15 @@ public:
 	void setRequestTimeout(int);
 	/** Set a handler for msgpack rpc requests **/
 	void setRequestHandler(MsgpackRequestHandler *);
+	/** Call an API function without tracking its result **/
+	void notify(const QByteArray& method, const QVariantList& args=QVariantList());
+	/** Collect API calls to be sent as a single request **/
+	NeovimBatch* startBatch();
+	/** Parse msgpack in a background thread, call before any data is received **/
+	bool startParserThread();
+	/** Set a typed handler for redraw notifications **/
+	void setRedrawHandler(MsgpackRedrawHandler *);
+	MsgpackRedrawHandler* redrawHandler() const noexcept { return m_dev->redrawHandler(); }
 
 	quint64 apiCompatibility();
 	quint64 apiLevel();
@@ -123,17 +125,12 @@ protected slots:
 
 private:
 	MsgpackIODevice *m_dev{ nullptr };
+	bool m_parserThread{ false };
 	NeovimConnectorHelper *m_helper{ nullptr };
 	QString m_errorString;
 	NeovimError m_error{ NoError };
 
-	NeovimApi0 *m_api0{ nullptr };
-	NeovimApi1 *m_api1{ nullptr };
-	NeovimApi2 *m_api2{ nullptr };
-	NeovimApi3 *m_api3{ nullptr };
-	NeovimApi4 *m_api4{ nullptr };
-	NeovimApi5 *m_api5{ nullptr };
-	NeovimApi6 *m_api6{ nullptr };
+	NeovimApi *m_api{ nullptr };
 	quint64 m_channel{ 0 };
 	quint64 m_api_compat{ 0 };
 	quint64 m_api_supported{ 0 };
@@ -1,4 +1,12 @@
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
 #include <QMap>
+#include <QSaveFile>
+#include <QStandardPaths>
 
 #include "neovimconnectorhelper.h"
 #include "neovimconnector.h"
@@ -30,13 +38,131 @@ void NeovimConnectorHelper::handleMetadataError(quint32 msgid, quint64, const QV
 	return;
 }
 
+/// Identifies the metadata cache file format
+static const quint32 c_metadataCacheMagic{ 0x6e716d01 };
+
+/**
+ * Path of the metadata cache file for a Neovim binary
+ *
+ * The file name is derived from the binary path, size and modification time,
+ * so a new Neovim build never reuses stale metadata. Returns an empty string
+ * if the binary cannot be found.
+ */
+static QString metadataCachePath(const QString& exe)
+{
+	QFileInfo info{ exe };
+	if (!info.isAbsolute() || !info.exists()) {
+		info = QFileInfo{ QStandardPaths::findExecutable(exe) };
+	}
+	if (!info.exists()) {
+		return QString();
+	}
+
+	const QString dir{ QStandardPaths::writableLocation(QStandardPaths::CacheLocation) };
+	if (dir.isEmpty()) {
+		return QString();
+	}
+
+	QCryptographicHash hash{ QCryptographicHash::Sha1 };
+	hash.addData(info.canonicalFilePath().toUtf8());
+	hash.addData(QByteArray::number(info.size()));
+	hash.addData(QByteArray::number(info.lastModified().toMSecsSinceEpoch()));
+	return QDir{ dir }.filePath(
+		QStringLiteral("api-metadata-%1").arg(QString::fromLatin1(hash.result().toHex())));
+}
+
+/**
+ * Load the metadata cached by a previous connection to the Neovim binary exe
+ *
+ * Returns true if cached metadata was found, it is applied once the
+ * connection is up, @see handleCachedMetadata
+ */
+bool NeovimConnectorHelper::loadMetadataCache(const QString& exe)
+{
+	m_cacheFile = metadataCachePath(exe);
+	if (m_cacheFile.isEmpty()) {
+		return false;
+	}
+
+	QFile f{ m_cacheFile };
+	if (!f.open(QIODevice::ReadOnly)) {
+		return false;
+	}
+
+	QDataStream in{ &f };
+	quint32 magic{ 0 };
+	in >> magic;
+	if (magic != c_metadataCacheMagic) {
+		return false;
+	}
+	in >> m_cachedApiCompat >> m_cachedApiLevel >> m_cachedUiOptions >> m_cachedVersion;
+	m_cached = (in.status() == QDataStream::Ok);
+	return m_cached;
+}
+
+void NeovimConnectorHelper::storeMetadataCache(const QVariantMap& version)
+{
+	if (m_cacheFile.isEmpty()) {
+		return;
+	}
+
+	QDir().mkpath(QFileInfo{ m_cacheFile }.absolutePath());
+	QSaveFile f{ m_cacheFile };
+	if (!f.open(QIODevice::WriteOnly)) {
+		qDebug() << "Unable to write API metadata cache" << m_cacheFile;
+		return;
+	}
+
+	QDataStream out{ &f };
+	out << c_metadataCacheMagic << m_c->m_api_compat << m_c->m_api_supported
+		<< m_c->m_uiOptions << version;
+	f.commit();
+}
+
+/**
+ * Mark the connector as ready using cached metadata
+ *
+ * Called once the metadata request was sent. The UI can attach right away,
+ * the metadata is verified when the response arrives in handleMetadata.
+ */
+void NeovimConnectorHelper::handleCachedMetadata()
+{
+	if (!hasCachedMetadata() || m_received
+			|| m_c->errorCause() != NeovimConnector::NoError) {
+		return;
+	}
+
+	m_c->m_api_compat = m_cachedApiCompat;
+	m_c->m_api_supported = m_cachedApiLevel;
+	m_c->m_uiOptions = m_cachedUiOptions;
+	m_optimistic = true;
+	m_c->m_ready = true;
+	emit m_c->ready();
+}
+
+/**
+ * Warn if Neovim lacks functions of the bindings up to the negotiated API
+ * level. Only new metadata is checked, cached metadata was checked when
+ * it was stored.
+ */
+void NeovimConnectorHelper::checkFunctions(const QVariantMap& metadata)
+{
+	const QVariantList functions{ metadata.value("functions").toList() };
+	if (!NeovimApi::checkFunctions(functions, m_c->apiLevel())) {
+		qWarning() << "Neovim does not provide all functions of API level" << m_c->apiLevel();
+	}
+}
+
 /**
  * Process metadata object returned by Neovim
  *
  * - Set channel_id
+ * - Check the function table against the bindings
  */
 void NeovimConnectorHelper::handleMetadata(quint32 msgid, quint64, const QVariant& result)
 {
+	m_received = true;
+
 	const QVariantList asList = result.toList();
 	if (asList.size() != 2
 		|| !asList.at(0).canConvert<quint64>()
@@ -48,13 +174,37 @@ void NeovimConnectorHelper::handleMetadata(quint32 msgid, quint64, const QVarian
 	m_c->m_channel = asList.at(0).toUInt();
 	const QVariantMap metadata = asList.at(1).toMap();
 
-	const int api_compat = metadata.value("version").toMap().value("api_compatible").toUInt();
-	const int api_level = metadata.value("version").toMap().value("api_level").toUInt();
+	const QVariantMap version = metadata.value("version").toMap();
+	const int api_compat = version.value("api_compatible").toUInt();
+	const int api_level = version.value("api_level").toUInt();
+	const QVariantList uiOptions = metadata.value("ui_options").toList();
 	// qDebug() << "Neovim API version compatible with" << api_compat << "supported" << api_level;
-	m_c->m_uiOptions = metadata.value("ui_options").toList();
+
+	if (m_optimistic) {
+		// The UI was started with cached metadata, refresh the cache if needed
+		if (m_c->m_api_compat != static_cast<quint64>(api_compat)
+				|| m_c->m_api_supported != static_cast<quint64>(api_level)
+				|| m_c->m_uiOptions != uiOptions
+				|| m_cachedVersion != version) {
+			qWarning() << "Cached Neovim API metadata is out of date, using" << version;
+			m_c->m_uiOptions = uiOptions;
+			m_c->m_api_compat = api_compat;
+			m_c->m_api_supported = api_level;
+			checkFunctions(metadata);
+			storeMetadataCache(version);
+		}
+		return;
+	}
+
+	m_c->m_uiOptions = uiOptions;
 	m_c->m_api_compat = api_compat;
 	m_c->m_api_supported = api_level;
 
+	if (!m_cached || m_cachedVersion != version) {
+		checkFunctions(metadata);
+		storeMetadataCache(version);
+	}
+
 	if (m_c->errorCause() == NeovimConnector::NoError) {
 		m_c->m_ready = true;
 		emit m_c->ready();
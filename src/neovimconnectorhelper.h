@@ -11,13 +11,30 @@ class NeovimConnectorHelper: public QObject
 public:
 	NeovimConnectorHelper(NeovimConnector *);
 
+	bool loadMetadataCache(const QString& exe);
+	bool hasCachedMetadata() const noexcept { return !m_cacheFile.isEmpty() && m_cached; }
+
 public slots:
 	void handleMetadata(quint32, quint64, const QVariant& result);
 	void handleMetadataError(quint32 msgid, quint64,
 		const QVariant& errobj);
+	void handleCachedMetadata();
+
 private:
+	void storeMetadataCache(const QVariantMap& version);
+	void checkFunctions(const QVariantMap& metadata);
+
 	NeovimConnector *m_c;
 
+	/// Cache file for the metadata of a spawned Neovim binary
+	QString m_cacheFile;
+	bool m_cached{ false };
+	bool m_optimistic{ false };
+	bool m_received{ false };
+	quint64 m_cachedApiCompat{ 0 };
+	quint64 m_cachedApiLevel{ 0 };
+	QVariantList m_cachedUiOptions;
+	QVariantMap m_cachedVersion;
 };
 
 } // Namespace NeovimQt
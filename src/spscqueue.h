@@ -0,0 +1,70 @@
+#ifndef NEOVIM_QT_SPSCQUEUE
+#define NEOVIM_QT_SPSCQUEUE
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace NeovimQt {
+
+/**
+ * A bounded lock-free queue for exactly one producer thread and one consumer
+ * thread. push() must only be called by the producer, pop() only by the
+ * consumer.
+ */
+template<class T>
+class SpscQueue
+{
+public:
+	explicit SpscQueue(size_t capacity) noexcept
+		: m_buffer(capacity + 1)
+	{
+	}
+
+	SpscQueue(const SpscQueue&) = delete;
+	SpscQueue& operator=(const SpscQueue&) = delete;
+
+	/// Returns false if the queue is full
+	bool push(T value) noexcept
+	{
+		const size_t tail{ m_tail.load(std::memory_order_relaxed) };
+		const size_t next{ increment(tail) };
+		if (next == m_head.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		m_buffer[tail] = std::move(value);
+		m_tail.store(next, std::memory_order_release);
+		return true;
+	}
+
+	/// Returns false if the queue is empty
+	bool pop(T& value) noexcept
+	{
+		const size_t head{ m_head.load(std::memory_order_relaxed) };
+		if (head == m_tail.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		value = std::move(m_buffer[head]);
+		m_buffer[head] = T();
+		m_head.store(increment(head), std::memory_order_release);
+		return true;
+	}
+
+	size_t capacity() const noexcept { return m_buffer.size() - 1; }
+
+private:
+	size_t increment(size_t index) const noexcept
+	{
+		return (index + 1 == m_buffer.size()) ? 0 : index + 1;
+	}
+
+	std::vector<T> m_buffer;
+	std::atomic<size_t> m_head{ 0 };
+	std::atomic<size_t> m_tail{ 0 };
+};
+
+} // Namespace NeovimQt
+#endif
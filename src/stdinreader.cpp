@@ -34,17 +34,23 @@ StdinReader::StdinReader(qint64 maxSize, QObject *parent)
 	}
 }
 
+/**
+ * Read until stdin is closed, each chunk is read straight into the
+ * QByteArray that is passed on by dataAvailable().
+ */
 void StdinReader::run()
 {
-	char *buf = new char[m_maxSize];
 	while (true) {
-		qint64 bytes = read(0, buf, m_maxSize);
-		if (bytes > 0 ) {
-			qDebug() << "Reading data from Stdin" << bytes;
-			emit dataAvailable(QByteArray(buf, bytes));
+		QByteArray data(static_cast<int>(m_maxSize), Qt::Uninitialized);
+		qint64 bytes = read(0, data.data(), data.size());
+		if (bytes <= 0) {
+			// EOF or error, QThread::finished() is emitted
+			break;
 		}
+
+		data.resize(bytes);
+		emit dataAvailable(data);
 	}
-	delete buf;
 }
 
 /**
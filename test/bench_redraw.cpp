@@ -0,0 +1,640 @@
+#include <QApplication>
+#include <QDir>
+#include <QFile>
+#include <QElapsedTimer>
+#include <QTest>
+
+#include <gui/shell.h>
+#include <msgpack.h>
+#include <msgpackiodevice.h>
+#include <msgpackredraw.h>
+#include <neovimconnector.h>
+
+#include "common.h"
+
+namespace NeovimQt {
+
+/**
+ * Replays msgpack-rpc streams through MsgpackIODevice and Shell.
+ *
+ * A few synthetic streams are always replayed. Recorded streams are read
+ * from the *.msgpack files in $NVIM_QT_REDRAW_TRACES, a stream is the raw
+ * output of `nvim --embed` while attached to a UI, e.g. recorded with a
+ * wrapper script passed as `nvim-qt --nvim` that pipes through `tee`.
+ *
+ * Time is reported separately for msgpack decoding, redraw handlers and
+ * painting. Decode time is the time spent in MsgpackIODevice less the
+ * time spent in the redraw handlers.
+ */
+
+/// Packs msgpack-rpc messages into a buffer
+class TraceWriter
+{
+public:
+	TraceWriter() noexcept
+	{
+		msgpack_sbuffer_init(&m_buffer);
+		msgpack_packer_init(&m_pk, &m_buffer, msgpack_sbuffer_write);
+	}
+
+	~TraceWriter() noexcept
+	{
+		msgpack_sbuffer_destroy(&m_buffer);
+	}
+
+	QByteArray data() const noexcept { return { m_buffer.data, static_cast<int>(m_buffer.size) }; }
+
+	/// [2, "redraw", [event...]], followed by eventCount events
+	void beginRedraw(uint32_t eventCount) noexcept
+	{
+		msgpack_pack_array(&m_pk, 3);
+		msgpack_pack_int(&m_pk, 2);
+		str("redraw");
+		msgpack_pack_array(&m_pk, eventCount);
+	}
+
+	/// [name, args...], a single argument tuple follows
+	void beginEvent(const char* name) noexcept
+	{
+		msgpack_pack_array(&m_pk, 2);
+		str(name);
+	}
+
+	void array(uint32_t size) noexcept { msgpack_pack_array(&m_pk, size); }
+	void map(uint32_t size) noexcept { msgpack_pack_map(&m_pk, size); }
+	void uint(uint64_t value) noexcept { msgpack_pack_uint64(&m_pk, value); }
+	void integer(int64_t value) noexcept { msgpack_pack_int64(&m_pk, value); }
+	void boolean(bool value) noexcept { value ? msgpack_pack_true(&m_pk) : msgpack_pack_false(&m_pk); }
+	void nil() noexcept { msgpack_pack_nil(&m_pk); }
+
+	void str(const QByteArray& value) noexcept
+	{
+		msgpack_pack_str(&m_pk, value.size());
+		msgpack_pack_str_body(&m_pk, value.constData(), value.size());
+	}
+
+	void flush() noexcept
+	{
+		beginEvent("flush");
+		array(0);
+	}
+
+	/// grid_line event for a row of text, cells are packed as runs of
+	/// ([text, hl_id], [text]...), spaces use the repeat count.
+	void gridLine(uint64_t row, const QList<QPair<QByteArray, uint64_t>>& tokens) noexcept
+	{
+		beginEvent("grid_line");
+		array(4);
+		uint(1);
+		uint(row);
+		uint(0);
+
+		uint32_t cellCount{ 0 };
+		for (const auto& token : tokens) {
+			cellCount += (token.first.trimmed().isEmpty()) ? 1 : token.first.size();
+		}
+
+		array(cellCount);
+		for (const auto& token : tokens) {
+			if (token.first.trimmed().isEmpty()) {
+				array(3);
+				str(" ");
+				uint(token.second);
+				uint(token.first.size());
+				continue;
+			}
+
+			for (int i=0; i<token.first.size(); i++) {
+				array((i == 0) ? 2 : 1);
+				str(token.first.mid(i, 1));
+				if (i == 0) {
+					uint(token.second);
+				}
+			}
+		}
+	}
+
+private:
+	msgpack_sbuffer m_buffer;
+	msgpack_packer m_pk;
+};
+
+/**
+ * A sequential device serving a stream to MsgpackIODevice. Requests written
+ * to the device are answered with a nil result, except vim_get_api_info which
+ * gets enough metadata for the connector to become ready.
+ */
+class TraceDevice: public QIODevice
+{
+	Q_OBJECT
+public:
+	TraceDevice(QObject* parent = nullptr) noexcept
+		: QIODevice{ parent }
+	{
+		msgpack_unpacker_init(&m_uk, MSGPACK_UNPACKER_INIT_BUFFER_SIZE);
+		open(QIODevice::ReadWrite | QIODevice::Unbuffered);
+	}
+
+	~TraceDevice() noexcept
+	{
+		msgpack_unpacker_destroy(&m_uk);
+	}
+
+	bool isSequential() const override { return true; }
+
+	qint64 bytesAvailable() const override
+	{
+		return m_pending.size() - m_readPos + QIODevice::bytesAvailable();
+	}
+
+	/// Queue data for the reader, readyRead() is emitted synchronously
+	void feed(const QByteArray& data) noexcept
+	{
+		m_pending.append(data);
+		emit readyRead();
+	}
+
+protected:
+	qint64 readData(char* data, qint64 maxSize) override
+	{
+		const qint64 size{ qMin<qint64>(maxSize, m_pending.size() - m_readPos) };
+		memcpy(data, m_pending.constData() + m_readPos, size);
+		m_readPos += size;
+
+		if (m_readPos == m_pending.size()) {
+			m_pending.clear();
+			m_readPos = 0;
+		}
+
+		return size;
+	}
+
+	qint64 writeData(const char* data, qint64 size) override
+	{
+		msgpack_unpacker_reserve_buffer(&m_uk, size);
+		memcpy(msgpack_unpacker_buffer(&m_uk), data, size);
+		msgpack_unpacker_buffer_consumed(&m_uk, size);
+
+		msgpack_unpacked result;
+		msgpack_unpacked_init(&result);
+		while (msgpack_unpacker_next(&m_uk, &result)) {
+			respond(result.data);
+		}
+		msgpack_unpacked_destroy(&result);
+
+		return size;
+	}
+
+private:
+	void respond(const msgpack_object& req) noexcept
+	{
+		// [0, msgid, method, params]
+		if (req.type != MSGPACK_OBJECT_ARRAY
+			|| req.via.array.size != 4
+			|| req.via.array.ptr[0].via.u64 != 0) {
+			return;
+		}
+
+		const MsgpackStringView method{ MsgpackStringView::fromObject(req.via.array.ptr[2]) };
+
+		TraceWriter response;
+		response.array(4);
+		response.integer(1);
+		response.uint(req.via.array.ptr[1].via.u64);
+		response.nil();
+
+		if (method == "vim_get_api_info" || method == "nvim_get_api_info") {
+			// [channel, {version: {...}, ui_options: [...]}]
+			response.array(2);
+			response.uint(1);
+			response.map(2);
+			response.str("version");
+			response.map(2);
+			response.str("api_compatible");
+			response.uint(0);
+			response.str("api_level");
+			response.uint(0);
+			response.str("ui_options");
+			response.array(2);
+			response.str("rgb");
+			response.str("ext_linegrid");
+		}
+		else {
+			response.nil();
+		}
+
+		// Answer after the request has been registered by the writer
+		m_pending.append(response.data());
+		QMetaObject::invokeMethod(this, "readyRead", Qt::QueuedConnection);
+	}
+
+	QByteArray m_pending;
+	int m_readPos{ 0 };
+	msgpack_unpacker m_uk;
+};
+
+/// Forwards redraw events to the Shell, timing each handler call
+class TimedRedrawHandler: public MsgpackRedrawHandler
+{
+public:
+	TimedRedrawHandler(MsgpackRedrawHandler& target) noexcept
+		: m_target(target)
+	{
+	}
+
+	void handleGridLine(const GridLineEvent& ev) override
+	{
+		m_timer.start();
+		m_target.handleGridLine(ev);
+		m_elapsedNs += m_timer.nsecsElapsed();
+	}
+
+	void handleGridCursorGoto(uint64_t grid, uint64_t row, uint64_t col) override
+	{
+		m_timer.start();
+		m_target.handleGridCursorGoto(grid, row, col);
+		m_elapsedNs += m_timer.nsecsElapsed();
+	}
+
+	void handleGridClear(uint64_t grid) override
+	{
+		m_timer.start();
+		m_target.handleGridClear(grid);
+		m_elapsedNs += m_timer.nsecsElapsed();
+	}
+
+	void handleFlush() override
+	{
+		m_timer.start();
+		m_target.handleFlush();
+		m_elapsedNs += m_timer.nsecsElapsed();
+		m_frames++;
+	}
+
+	void handleRedrawEvent(const QByteArray& name, const QVariantList& args) override
+	{
+		m_timer.start();
+		m_target.handleRedrawEvent(name, args);
+		m_elapsedNs += m_timer.nsecsElapsed();
+	}
+
+	qint64 elapsedNs() const noexcept { return m_elapsedNs; }
+	int frames() const noexcept { return m_frames; }
+
+private:
+	MsgpackRedrawHandler& m_target;
+	QElapsedTimer m_timer;
+	qint64 m_elapsedNs{ 0 };
+	int m_frames{ 0 };
+};
+
+constexpr int c_rows{ 40 };
+constexpr int c_columns{ 120 };
+
+/// Deterministic pseudo-random source text
+static QByteArray GetWord(uint32_t& seed) noexcept
+{
+	static const char* words[]{ "if", "return", "const", "auto", "for", "while",
+		"m_contents", "value", "QString", "nullptr", "int", "static", "=", "{", "}",
+		"(", ")", ";", "->", "==", "!=", "row", "column", "cell", "0", "42", "\"text\"" };
+	seed = seed * 1103515245 + 12345;
+	return words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+}
+
+/// A line of tokens, each token uses a highlight id from [1, hlCount]
+static QList<QPair<QByteArray, uint64_t>> GetLine(uint32_t& seed, int hlCount, int indent) noexcept
+{
+	QList<QPair<QByteArray, uint64_t>> tokens;
+	int width{ indent };
+	if (indent > 0) {
+		tokens.append({ QByteArray(indent, ' '), 0 });
+	}
+
+	while (true) {
+		const QByteArray word{ GetWord(seed) };
+		if (width + word.size() + 1 > c_columns) {
+			break;
+		}
+
+		tokens.append({ word, 1 + (seed >> 8) % hlCount });
+		tokens.append({ " ", 0 });
+		width += word.size() + 1;
+	}
+
+	if (width < c_columns) {
+		tokens.append({ QByteArray(c_columns - width, ' '), 0 });
+	}
+
+	return tokens;
+}
+
+/// grid_resize, default colors and highlight definitions
+static void WritePreamble(TraceWriter& w, int hlCount) noexcept
+{
+	w.beginRedraw(4 + hlCount);
+
+	w.beginEvent("grid_resize");
+	w.array(3);
+	w.uint(1);
+	w.uint(c_columns);
+	w.uint(c_rows);
+
+	w.beginEvent("default_colors_set");
+	w.array(5);
+	w.integer(0xD0D0D0);
+	w.integer(0x1C1C1C);
+	w.integer(0xFF0000);
+	w.integer(-1);
+	w.integer(-1);
+
+	for (int i=1; i<=hlCount; i++) {
+		w.beginEvent("hl_attr_define");
+		w.array(4);
+		w.uint(i);
+		w.map(3);
+		w.str("foreground");
+		w.integer(0x404040 + i * 0x0B1733 % 0xBFBFBF);
+		w.str("bold");
+		w.boolean(i % 5 == 0);
+		w.str("italic");
+		w.boolean(i % 7 == 0);
+		w.map(0);
+		w.array(0);
+	}
+
+	w.beginEvent("grid_clear");
+	w.array(1);
+	w.uint(1);
+
+	w.flush();
+}
+
+static void WriteFullRedraw(TraceWriter& w, uint32_t& seed, int hlCount) noexcept
+{
+	w.beginRedraw(c_rows + 2);
+	for (int row=0; row<c_rows; row++) {
+		w.gridLine(row, GetLine(seed, hlCount, (seed >> 4) % 4 * 4));
+	}
+
+	w.beginEvent("grid_cursor_goto");
+	w.array(3);
+	w.uint(1);
+	w.uint(seed % c_rows);
+	w.uint(seed % c_columns);
+
+	w.flush();
+}
+
+/// Scrolling a large file one line at a time
+static QByteArray GetScrollTrace() noexcept
+{
+	constexpr int hlCount{ 12 };
+	TraceWriter w;
+	uint32_t seed{ 1 };
+
+	WritePreamble(w, hlCount);
+	WriteFullRedraw(w, seed, hlCount);
+
+	for (int i=0; i<300; i++) {
+		w.beginRedraw(5);
+
+		w.beginEvent("grid_scroll");
+		w.array(7);
+		w.uint(1);
+		w.uint(0);
+		w.uint(c_rows - 1);
+		w.uint(0);
+		w.uint(c_columns);
+		w.integer(1);
+		w.integer(0);
+
+		w.gridLine(c_rows - 2, GetLine(seed, hlCount, 4));
+		w.gridLine(c_rows - 1, { { QByteArray("file.cpp ") + QByteArray::number(i), hlCount },
+			{ QByteArray(c_columns - 10 - QByteArray::number(i).size(), ' '), hlCount } });
+
+		w.beginEvent("grid_cursor_goto");
+		w.array(3);
+		w.uint(1);
+		w.uint(c_rows - 2);
+		w.uint(4);
+
+		w.flush();
+	}
+
+	return w.data();
+}
+
+/// :help navigation, every jump redraws the whole screen
+static QByteArray GetHelpTrace() noexcept
+{
+	constexpr int hlCount{ 6 };
+	TraceWriter w;
+	uint32_t seed{ 2 };
+
+	WritePreamble(w, hlCount);
+	for (int i=0; i<60; i++) {
+		WriteFullRedraw(w, seed, hlCount);
+	}
+
+	return w.data();
+}
+
+/// Insert mode completion, typing with a popup menu
+static QByteArray GetPopupmenuTrace() noexcept
+{
+	constexpr int hlCount{ 8 };
+	TraceWriter w;
+	uint32_t seed{ 3 };
+
+	WritePreamble(w, hlCount);
+	WriteFullRedraw(w, seed, hlCount);
+
+	QByteArray typed;
+	for (int i=0; i<100; i++) {
+		typed += GetWord(seed).left(1);
+		if (typed.size() > 40) {
+			typed.clear();
+		}
+
+		w.beginRedraw(5);
+		w.gridLine(10, { { typed, 1 }, { QByteArray(c_columns - typed.size(), ' '), 0 } });
+
+		w.beginEvent("popupmenu_show");
+		w.array(5);
+		w.array(12);
+		for (int j=0; j<12; j++) {
+			w.array(4);
+			w.str(typed + GetWord(seed));
+			w.str("v");
+			w.str("");
+			w.str("");
+		}
+		w.integer(-1);
+		w.uint(11);
+		w.uint(0);
+		w.uint(1);
+
+		w.beginEvent("popupmenu_select");
+		w.array(1);
+		w.integer(i % 12);
+
+		w.beginEvent("grid_cursor_goto");
+		w.array(3);
+		w.uint(1);
+		w.uint(10);
+		w.uint(typed.size());
+
+		w.flush();
+	}
+
+	w.beginRedraw(2);
+	w.beginEvent("popupmenu_hide");
+	w.array(0);
+	w.flush();
+
+	return w.data();
+}
+
+/// A buffer with many highlight groups, redrawn after colorscheme changes
+static QByteArray GetSyntaxTrace() noexcept
+{
+	constexpr int hlCount{ 120 };
+	TraceWriter w;
+	uint32_t seed{ 4 };
+
+	WritePreamble(w, hlCount);
+	for (int i=0; i<60; i++) {
+		WriteFullRedraw(w, seed, hlCount);
+	}
+
+	return w.data();
+}
+
+/// Split a stream into msgpack messages
+static QList<QByteArray> SplitMessages(const QByteArray& trace) noexcept
+{
+	QList<QByteArray> messages;
+
+	msgpack_unpacker uk;
+	msgpack_unpacker_init(&uk, MSGPACK_UNPACKER_INIT_BUFFER_SIZE);
+	msgpack_unpacker_reserve_buffer(&uk, trace.size());
+	memcpy(msgpack_unpacker_buffer(&uk), trace.constData(), trace.size());
+	msgpack_unpacker_buffer_consumed(&uk, trace.size());
+
+	msgpack_unpacked result;
+	msgpack_unpacked_init(&result);
+	size_t begin{ 0 };
+	while (msgpack_unpacker_next(&uk, &result)) {
+		const size_t end{ msgpack_unpacker_parsed_size(&uk) };
+		messages.append(trace.mid(begin, end - begin));
+		begin = end;
+	}
+
+	msgpack_unpacked_destroy(&result);
+	msgpack_unpacker_destroy(&uk);
+	return messages;
+}
+
+class BenchRedraw: public QObject
+{
+	Q_OBJECT
+
+private slots:
+	void replay_data();
+	void replay();
+};
+
+void BenchRedraw::replay_data()
+{
+	QTest::addColumn<QByteArray>("trace");
+
+	QTest::newRow("scroll") << GetScrollTrace();
+	QTest::newRow("help") << GetHelpTrace();
+	QTest::newRow("popupmenu") << GetPopupmenuTrace();
+	QTest::newRow("syntax") << GetSyntaxTrace();
+
+	const QString traceDir{ QString::fromLocal8Bit(qgetenv("NVIM_QT_REDRAW_TRACES")) };
+	if (traceDir.isEmpty()) {
+		return;
+	}
+
+	const QDir dir{ traceDir };
+	for (const QString& name : dir.entryList({ "*.msgpack" }, QDir::Files)) {
+		QFile file{ dir.filePath(name) };
+		QVERIFY(file.open(QIODevice::ReadOnly));
+		QTest::newRow(qPrintable(name)) << file.readAll();
+	}
+}
+
+void BenchRedraw::replay()
+{
+	QFETCH(QByteArray, trace);
+
+	const QList<QByteArray> messages{ SplitMessages(trace) };
+	QVERIFY(!messages.isEmpty());
+
+	TraceDevice* dev{ new TraceDevice };
+	NeovimConnector c{ dev };
+	QSignalSpy onReady{ &c, &NeovimConnector::ready };
+	QVERIFY(onReady.isValid());
+	QVERIFY(SPYWAIT(onReady));
+
+	Shell s{ &c };
+	s.resize(s.cellSize().width() * c_columns, s.cellSize().height() * c_rows);
+	s.show();
+
+	// Shell::init() installs itself as the redraw handler
+	QTRY_VERIFY(c.redrawHandler() == &s);
+
+	TimedRedrawHandler handler{ s };
+	c.setRedrawHandler(&handler);
+	QObject::disconnect(c.api0(), &NeovimApi0::neovimNotification, &s, nullptr);
+
+	qint64 dispatchNs{ 0 };
+	qint64 paintNs{ 0 };
+	QElapsedTimer timer;
+	for (const QByteArray& message : messages) {
+		timer.start();
+		dev->feed(message);
+		dispatchNs += timer.nsecsElapsed();
+
+		timer.start();
+		QCoreApplication::processEvents();
+		paintNs += timer.nsecsElapsed();
+	}
+
+	c.setRedrawHandler(nullptr);
+
+	const qint64 handlerNs{ handler.elapsedNs() };
+	const qint64 decodeNs{ dispatchNs - handlerNs };
+	const qint64 totalNs{ dispatchNs + paintNs };
+	const qreal framesPerSecond{ (totalNs > 0) ? handler.frames() * 1e9 / totalNs : 0 };
+
+	qInfo().noquote() << QStringLiteral(
+		"%1: %2 messages, %3 frames, decode %4 ms, handler %5 ms, paint %6 ms, %7 frames/s")
+		.arg(QTest::currentDataTag())
+		.arg(messages.size())
+		.arg(handler.frames())
+		.arg(decodeNs / 1e6, 0, 'f', 2)
+		.arg(handlerNs / 1e6, 0, 'f', 2)
+		.arg(paintNs / 1e6, 0, 'f', 2)
+		.arg(framesPerSecond, 0, 'f', 1);
+
+	QTest::setBenchmarkResult(framesPerSecond, QTest::FramesPerSecond);
+}
+
+} // Namespace NeovimQt
+
+int main(int argc, char** argv)
+{
+	// Paint without a display server unless a platform is requested
+	if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+		qputenv("QT_QPA_PLATFORM", "offscreen");
+	}
+
+	QApplication app{ argc, argv };
+	NeovimQt::BenchRedraw bench;
+	return QTest::qExec(&bench, argc, argv);
+}
+
+#include "bench_redraw.moc"
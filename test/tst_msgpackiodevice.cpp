@@ -4,8 +4,14 @@
 #include <QTcpSocket>
 #include <QRegularExpression>
 #include <QBuffer>
+#include <QSocketNotifier>
+#ifndef _WIN32
+# include <unistd.h>
+#endif
 
 #include <msgpackiodevice.h>
+#include <msgpackparser.h>
+#include <msgpackredraw.h>
 #include <msgpackrequest.h>
 #include "common.h"
 
@@ -13,7 +19,7 @@ namespace NeovimQt {
 
 /**
  * A dummy request handler to help testing, it responds to all calls
- * with response
+ * with response, except for the methods in unanswered
  */
 class RequestHandler: public QObject, public MsgpackRequestHandler
 {
@@ -21,15 +27,67 @@ class RequestHandler: public QObject, public MsgpackRequestHandler
 public:
 	RequestHandler(QObject *parent=0):QObject(parent) {}
 	virtual void handleRequest(MsgpackIODevice* dev, quint32 msgid, const QByteArray& method, const QVariantList& params) {
-		dev->sendResponse(msgid, QVariant(), response);
+		if (!unanswered.contains(method)) {
+			dev->sendResponse(msgid, QVariant(), response);
+		}
 		emit receivedRequest(msgid, method, params);
 	}
 	QVariant response;
+	QList<QByteArray> unanswered;
 signals:
 	void receivedRequest(quint32 msgid, const QByteArray&, const QVariantList&);
 
 };
 
+/**
+ * A dummy redraw handler, copies the typed events it receives into
+ * signals since the views are only valid during dispatch
+ */
+class RedrawHandler: public QObject, public MsgpackRedrawHandler
+{
+	Q_OBJECT
+public:
+	RedrawHandler(QObject *parent=0):QObject(parent) {}
+	virtual void handleGridLine(const GridLineEvent& ev) {
+		QVariantList cells;
+		for (const GridLineCell& cell : ev.cells) {
+			cells << QVariant(QVariantList{
+				cell.text.toByteArray(),
+				cell.hasHighlightId ? QVariant((quint64)cell.highlightId) : QVariant(),
+				(quint64)cell.repeat });
+		}
+		emit receivedGridLine(ev.grid, ev.row, ev.colStart, cells);
+	}
+	virtual void handleGridCursorGoto(uint64_t grid, uint64_t row, uint64_t col) {
+		emit receivedGridCursorGoto(grid, row, col);
+	}
+	virtual void handleGridClear(uint64_t grid) {
+		emit receivedGridClear(grid);
+	}
+	virtual void handleFlush() {
+		emit receivedFlush();
+	}
+	virtual void handleRedrawEvent(const QByteArray& name, const QVariantList& args) {
+		emit receivedRedrawEvent(name, args);
+	}
+signals:
+	void receivedGridLine(quint64 grid, quint64 row, quint64 col, const QVariantList& cells);
+	void receivedGridCursorGoto(quint64 grid, quint64 row, quint64 col);
+	void receivedGridClear(quint64 grid);
+	void receivedFlush();
+	void receivedRedrawEvent(const QByteArray&, const QVariantList&);
+};
+
+/**
+ * Exposes the fd input path used by MsgpackIODevice::fromStdinOut
+ */
+class FdDevice: public MsgpackIODevice
+{
+public:
+	FdDevice():MsgpackIODevice(nullptr) {}
+	using MsgpackIODevice::dataAvailableFd;
+};
+
 class Test: public QObject
 {
 	Q_OBJECT
@@ -122,6 +180,201 @@ private slots:
 		QCOMPARE(n.at(1).toList(), params);
 	}
 
+	void notificationBurst() {
+		QSignalSpy onNotification(two, SIGNAL(notification(QByteArray, QVariantList)));
+		QVERIFY(onNotification.isValid());
+
+		// Buffered messages are written in order on the next event loop iteration
+		for (int i=0; i<100; i++) {
+			one->sendNotification("testBurst", QVariantList() << i);
+		}
+
+		QTRY_COMPARE(onNotification.count(), 100);
+		for (int i=0; i<100; i++) {
+			QCOMPARE(onNotification.at(i).at(1).toList(), QVariantList() << i);
+		}
+	}
+
+	void largeNotification() {
+		QSignalSpy onNotification(two, SIGNAL(notification(QByteArray, QVariantList)));
+		QVERIFY(onNotification.isValid());
+
+		// Larger than the read size, arrives in many reads
+		const QByteArray payload(3 * 1024 * 1024, 'x');
+		one->sendNotification("testLarge", QVariantList() << payload);
+		one->sendNotification("testSmall", QVariantList() << 1);
+
+		QTRY_COMPARE(onNotification.count(), 2);
+		QCOMPARE(onNotification.at(0).at(1).toList().at(0).toByteArray(), payload);
+		QCOMPARE(onNotification.at(1).at(0).toByteArray(), QByteArray("testSmall"));
+	}
+
+	void parserThread() {
+		QVERIFY(two->startParserThread());
+
+		QSignalSpy onNotification(two, SIGNAL(notification(QByteArray, QVariantList)));
+		QVERIFY(onNotification.isValid());
+
+		const QByteArray payload(3 * 1024 * 1024, 'x');
+		one->sendNotification("testLarge", QVariantList() << payload);
+		for (int i=0; i<100; i++) {
+			one->sendNotification("testThread", QVariantList() << i);
+		}
+
+		QTRY_COMPARE(onNotification.count(), 101);
+		QCOMPARE(onNotification.at(0).at(1).toList().at(0).toByteArray(), payload);
+		for (int i=0; i<100; i++) {
+			QCOMPARE(onNotification.at(i + 1).at(1).toList(), QVariantList() << i);
+		}
+
+		// Requests are still dispatched, and answered, in this thread
+		auto req = two->startRequestUnchecked("testRequest", 0);
+		QSignalSpy gotResp(req, SIGNAL(error(quint32, quint64, QVariant)));
+		QVERIFY(gotResp.isValid());
+		QVERIFY2(SPYWAIT(gotResp), "By default all requests get an error");
+	}
+
+	void parserChunks() {
+		// [type(2), method, [i]] for i in 0..4
+		msgpack_sbuffer sbuf;
+		msgpack_sbuffer_init(&sbuf);
+		msgpack_packer pk;
+		msgpack_packer_init(&pk, &sbuf, msgpack_sbuffer_write);
+		QList<size_t> ends;
+		for (int i=0; i<5; i++) {
+			msgpack_pack_array(&pk, 3);
+			msgpack_pack_int(&pk, 2);
+			msgpack_pack_bin(&pk, 9);
+			msgpack_pack_bin_body(&pk, "testChunk", 9);
+			msgpack_pack_array(&pk, 1);
+			msgpack_pack_int(&pk, i);
+			ends << sbuf.size;
+		}
+		const QByteArray packed(sbuf.data, static_cast<int>(sbuf.size));
+		msgpack_sbuffer_destroy(&sbuf);
+
+		// Chunks end inside messages 1 and 3, and after messages 2 and 3.
+		// Messages within a chunk are unpacked in place, split ones are
+		// assembled by the streaming unpacker.
+		const int split1 = static_cast<int>(ends.at(0) + 3);
+		const int split2 = static_cast<int>(ends.at(2));
+		const int split3 = static_cast<int>(ends.at(2) + 1);
+		const int split4 = static_cast<int>(ends.at(3));
+
+		MsgpackParser parser;
+		parser.start();
+		QVERIFY(parser.push(packed.left(split1)));
+		QVERIFY(parser.push(packed.mid(split1, split2 - split1)));
+		QVERIFY(parser.push(packed.mid(split2, split3 - split2)));
+		QVERIFY(parser.push(packed.mid(split3, split4 - split3)));
+		QVERIFY(parser.push(packed.mid(split4)));
+
+		QList<int64_t> received;
+		QTRY_VERIFY2(([&]() {
+			parser.clearNotification();
+			MsgpackParser::Message msg;
+			while (parser.pop(msg)) {
+				const msgpack_object& obj = msg.data;
+				if (obj.type == MSGPACK_OBJECT_ARRAY && obj.via.array.size == 3
+						&& obj.via.array.ptr[2].type == MSGPACK_OBJECT_ARRAY
+						&& obj.via.array.ptr[2].via.array.size == 1) {
+					received << obj.via.array.ptr[2].via.array.ptr[0].via.i64;
+				}
+				msgpack_zone_free(msg.zone);
+			}
+			return received.size() == 5;
+		})(), "All messages are unpacked");
+		QCOMPARE(received, (QList<int64_t>{ 0, 1, 2, 3, 4 }));
+	}
+
+	void redrawHandler() {
+		RedrawHandler *handler = new RedrawHandler(two);
+		two->setRedrawHandler(handler);
+		QCOMPARE(two->redrawHandler(), handler);
+
+		QSignalSpy onGridLine(handler, SIGNAL(receivedGridLine(quint64, quint64, quint64, QVariantList)));
+		QVERIFY(onGridLine.isValid());
+		QSignalSpy onGridCursorGoto(handler, SIGNAL(receivedGridCursorGoto(quint64, quint64, quint64)));
+		QVERIFY(onGridCursorGoto.isValid());
+		QSignalSpy onGridClear(handler, SIGNAL(receivedGridClear(quint64)));
+		QVERIFY(onGridClear.isValid());
+		QSignalSpy onFlush(handler, SIGNAL(receivedFlush()));
+		QVERIFY(onFlush.isValid());
+		QSignalSpy onRedrawEvent(handler, SIGNAL(receivedRedrawEvent(QByteArray, QVariantList)));
+		QVERIFY(onRedrawEvent.isValid());
+		QSignalSpy onNotification(two, SIGNAL(notification(QByteArray, QVariantList)));
+		QVERIFY(onNotification.isValid());
+
+		// ["grid_line", grid, row, col_start, [[text, hl_id?, repeat?], ...]]
+		const QVariantList cells{
+			QVariant(QVariantList{ QByteArray("a"), 3 }),
+			QVariant(QVariantList{ QByteArray(" "), 4, 2 }),
+			QVariant(QVariantList{ QByteArray("b") }) };
+		const QVariantList gridLine{ QByteArray("grid_line"),
+			QVariant(QVariantList{ 1, 2, 5, cells }) };
+		const QVariantList gridCursorGoto{ QByteArray("grid_cursor_goto"),
+			QVariant(QVariantList{ 1, 2, 9 }) };
+		const QVariantList gridClear{ QByteArray("grid_clear"),
+			QVariant(QVariantList{ 1 }) };
+		const QVariantList modeChange{ QByteArray("mode_change"),
+			QVariant(QVariantList{ QByteArray("insert"), 1 }) };
+		const QVariantList flush{ QByteArray("flush"), QVariant(QVariantList{}) };
+
+		const QVariantList batch{ gridClear, gridLine, gridCursorGoto, modeChange, flush };
+		one->sendNotification("redraw", batch);
+		QVERIFY(SPYWAIT(onFlush));
+
+		QCOMPARE(onGridClear.count(), 1);
+		QCOMPARE(onGridClear.at(0).at(0).toULongLong(), (quint64)1);
+
+		QCOMPARE(onGridLine.count(), 1);
+		QCOMPARE(onGridLine.at(0).at(0).toULongLong(), (quint64)1);
+		QCOMPARE(onGridLine.at(0).at(1).toULongLong(), (quint64)2);
+		QCOMPARE(onGridLine.at(0).at(2).toULongLong(), (quint64)5);
+		const QVariantList received{ onGridLine.at(0).at(3).toList() };
+		QCOMPARE(received.size(), 3);
+		QCOMPARE(received.at(0).toList().at(0).toByteArray(), QByteArray("a"));
+		QCOMPARE(received.at(0).toList().at(1).toULongLong(), (quint64)3);
+		QCOMPARE(received.at(0).toList().at(2).toULongLong(), (quint64)1);
+		QCOMPARE(received.at(1).toList().at(0).toByteArray(), QByteArray(" "));
+		QCOMPARE(received.at(1).toList().at(1).toULongLong(), (quint64)4);
+		QCOMPARE(received.at(1).toList().at(2).toULongLong(), (quint64)2);
+		QCOMPARE(received.at(2).toList().at(0).toByteArray(), QByteArray("b"));
+		QVERIFY(!received.at(2).toList().at(1).isValid());
+
+		QCOMPARE(onGridCursorGoto.count(), 1);
+		QCOMPARE(onGridCursorGoto.at(0).at(2).toULongLong(), (quint64)9);
+
+		// Untyped events go through handleRedrawEvent and are re-emitted
+		QCOMPARE(onRedrawEvent.count(), 1);
+		QCOMPARE(onRedrawEvent.at(0).at(0).toByteArray(), QByteArray("mode_change"));
+		QCOMPARE(onRedrawEvent.at(0).at(1).toList().at(0).toByteArray(), QByteArray("insert"));
+
+		QCOMPARE(onNotification.count(), 1);
+		QCOMPARE(onNotification.at(0).at(0).toByteArray(), QByteArray("redraw"));
+		const QVariantList residual{ onNotification.at(0).at(1).toList() };
+		QCOMPARE(residual.size(), 1);
+		QCOMPARE(residual.at(0).toList().at(0).toByteArray(), QByteArray("mode_change"));
+
+		// Malformed grid events fall back to handleRedrawEvent
+		const QVariantList brokenGridLine{ QByteArray("grid_line"),
+			QVariant(QVariantList{ 1, 2 }) };
+		onFlush.clear();
+		one->sendNotification("redraw", QVariantList{ brokenGridLine, flush });
+		QVERIFY(SPYWAIT(onFlush));
+		QCOMPARE(onGridLine.count(), 1);
+		QCOMPARE(onRedrawEvent.count(), 2);
+		QCOMPARE(onRedrawEvent.at(1).at(0).toByteArray(), QByteArray("grid_line"));
+
+		// Without a handler all events are emitted as a notification
+		two->setRedrawHandler(nullptr);
+		onNotification.clear();
+		one->sendNotification("redraw", QVariantList{ gridLine, flush });
+		QVERIFY(SPYWAIT(onNotification));
+		QCOMPARE(onNotification.at(0).at(1).toList().size(), 2);
+		QCOMPARE(onGridLine.count(), 1);
+	}
+
 	void request() {
 		auto req = one->startRequestUnchecked("testRequest", 0);
 		
@@ -153,6 +406,34 @@ private slots:
 		QVERIFY2(SPYWAIT(gotResp2), "RequestHandler sends back a response");
 	}
 
+	void resultDecoder() {
+		RequestHandler *handler = new RequestHandler(two);
+		handler->response = 42;
+		two->setRequestHandler(handler);
+
+		int64_t result{ 0 };
+		MsgpackRequest *req = one->startRequestUnchecked("testDecoder", 0);
+		req->setResultDecoder([&](MsgpackIODevice *dev, const msgpack_object& res) {
+			return dev->decodeMsgpack(res, result);
+		});
+		QSignalSpy finished(req, SIGNAL(finished(quint32, quint64, QVariant)));
+		QVERIFY(finished.isValid());
+		QVERIFY(SPYWAIT(finished));
+		QCOMPARE(result, int64_t{ 42 });
+
+		// A failing decoder emits error() and not finished()
+		MsgpackRequest *broken = one->startRequestUnchecked("testDecoder", 0);
+		broken->setResultDecoder([](MsgpackIODevice *, const msgpack_object&) {
+			return true;
+		});
+		QSignalSpy brokenError(broken, SIGNAL(error(quint32, quint64, QVariant)));
+		QVERIFY(brokenError.isValid());
+		QSignalSpy brokenFinished(broken, SIGNAL(finished(quint32, quint64, QVariant)));
+		QVERIFY(brokenFinished.isValid());
+		QVERIFY(SPYWAIT(brokenError));
+		QCOMPARE(brokenFinished.count(), 0);
+	}
+
 	void checkVariant()
 	{
 		// Some Unsupported types
@@ -200,6 +481,128 @@ private slots:
 		QCOMPARE(params.at(0).toUInt(), r->id);
 	}
 
+	void timeoutShared() {
+		RequestHandler *handler = new RequestHandler(two);
+		handler->unanswered << "testTimeoutLate" << "testTimeoutEarly";
+		two->setRequestHandler(handler);
+
+		// Requests share one timer, each expires at its own deadline
+		MsgpackRequest *late = one->startRequestUnchecked("testTimeoutLate", 0);
+		late->setTimeout(400);
+		MsgpackRequest *early = one->startRequestUnchecked("testTimeoutEarly", 0);
+		early->setTimeout(100);
+		MsgpackRequest *answered = one->startRequestUnchecked("testTimeoutAnswered", 0);
+		answered->setTimeout(200);
+		const quint32 answeredId = answered->id;
+
+		QSignalSpy lateTimedOut(late, SIGNAL(timeout(quint32)));
+		QVERIFY(lateTimedOut.isValid());
+		QSignalSpy earlyTimedOut(early, SIGNAL(timeout(quint32)));
+		QVERIFY(earlyTimedOut.isValid());
+		QSignalSpy answeredTimedOut(answered, SIGNAL(timeout(quint32)));
+		QVERIFY(answeredTimedOut.isValid());
+		QSignalSpy answeredFinished(answered, SIGNAL(finished(quint32, quint64, QVariant)));
+		QVERIFY(answeredFinished.isValid());
+
+		QVERIFY(SPYWAIT(answeredFinished));
+		QVERIFY(!one->pendingRequests().contains(answeredId));
+
+		QVERIFY(SPYWAIT(earlyTimedOut));
+		QCOMPARE(lateTimedOut.count(), 0);
+
+		// The answered deadline passes before the late one
+		QVERIFY(SPYWAIT(lateTimedOut));
+		QCOMPARE(answeredTimedOut.count(), 0);
+		QVERIFY(one->pendingRequests().isEmpty());
+	}
+
+	void requestPool() {
+		RequestHandler *handler = new RequestHandler(two);
+		two->setRequestHandler(handler);
+
+		MsgpackRequest *req = one->startRequestUnchecked("testRequestPool", 0);
+		const quint32 firstId = req->id;
+		QSignalSpy finished(req, SIGNAL(finished(quint32, quint64, QVariant)));
+		QVERIFY(finished.isValid());
+		QVERIFY(SPYWAIT(finished));
+
+		// A finished request is reused for the next call, without the
+		// connections of the previous one
+		MsgpackRequest *next = one->startRequestUnchecked("testRequestPool", 0);
+		QCOMPARE(next, req);
+		QVERIFY(next->id != firstId);
+
+		QSignalSpy nextFinished(next, SIGNAL(finished(quint32, quint64, QVariant)));
+		QVERIFY(nextFinished.isValid());
+		QVERIFY(SPYWAIT(nextFinished));
+		QCOMPARE(nextFinished.at(0).at(0).toUInt(), next->id);
+		QCOMPARE(finished.count(), 1);
+	}
+
+	void startNotification() {
+		QSignalSpy onNotification(two, SIGNAL(notification(QByteArray, QVariantList)));
+		QVERIFY(onNotification.isValid());
+
+		const quint32 msgid = one->msgId();
+		one->startNotificationUnchecked("testFireAndForget", 1);
+		one->send(QByteArray("keys"));
+		QVERIFY(SPYWAIT(onNotification));
+
+		QCOMPARE(onNotification.at(0).at(0).toByteArray(), QByteArray("testFireAndForget"));
+		QCOMPARE(onNotification.at(0).at(1).toList(), QVariantList() << QByteArray("keys"));
+
+		// No request was allocated
+		QCOMPARE(one->pendingRequests(), QList<quint32>());
+		QCOMPARE(one->msgId(), msgid + 1);
+	}
+
+	void fdInputClosed() {
+#ifdef _WIN32
+		QSKIP("Fd input is not used on Windows");
+#else
+		int fds[2];
+		QCOMPARE(pipe(fds), 0);
+
+		FdDevice dev;
+		QSocketNotifier notifier{ fds[0], QSocketNotifier::Read };
+		connect(&notifier, &QSocketNotifier::activated,
+				&dev, &FdDevice::dataAvailableFd);
+
+		QSignalSpy onNotification(&dev, SIGNAL(notification(QByteArray, QVariantList)));
+		QVERIFY(onNotification.isValid());
+		QSignalSpy onAboutToClose(&dev, SIGNAL(aboutToClose()));
+		QVERIFY(onAboutToClose.isValid());
+
+		// [type(2), method, args]
+		msgpack_sbuffer sbuf;
+		msgpack_sbuffer_init(&sbuf);
+		msgpack_packer pk;
+		msgpack_packer_init(&pk, &sbuf, msgpack_sbuffer_write);
+		msgpack_pack_array(&pk, 3);
+		msgpack_pack_int(&pk, 2);
+		msgpack_pack_bin(&pk, 8);
+		msgpack_pack_bin_body(&pk, "testPipe", 8);
+		msgpack_pack_array(&pk, 0);
+		QCOMPARE(write(fds[1], sbuf.data, sbuf.size), static_cast<ssize_t>(sbuf.size));
+		msgpack_sbuffer_destroy(&sbuf);
+
+		QVERIFY(SPYWAIT(onNotification));
+		QCOMPARE(onNotification.at(0).at(0).toByteArray(), QByteArray("testPipe"));
+		QCOMPARE(onAboutToClose.count(), 0);
+		QCOMPARE(dev.errorCause(), MsgpackIODevice::NoError);
+
+		// EOF closes the channel and stops the notifier
+		close(fds[1]);
+		QVERIFY(SPYWAIT(onAboutToClose));
+		QCOMPARE(dev.errorCause(), MsgpackIODevice::InvalidDevice);
+		QVERIFY(!dev.errorString().isEmpty());
+		QVERIFY(!notifier.isEnabled());
+		QCOMPARE(onAboutToClose.count(), 1);
+
+		close(fds[0]);
+#endif
+	}
+
 };
 
 } // Namespace NeovimQt
@@ -4,7 +4,11 @@
 #include <QTcpSocket>
 #include <QRegularExpression>
 #include <QBuffer>
+#include <QDir>
+#include <QStandardPaths>
 
+#include <neovimbatch.h>
+#include <msgpackrequest.h>
 #include <neovimconnector.h>
 #include "common.h"
 
@@ -13,7 +17,23 @@ namespace NeovimQt {
 class Test: public QObject
 {
 	Q_OBJECT
+private:
+	/// Remove the metadata cache files from the cache directory
+	static void removeMetadataCache() {
+		QDir dir{ QStandardPaths::writableLocation(QStandardPaths::CacheLocation) };
+		for (const QString& name : dir.entryList({ "api-metadata-*" }, QDir::Files)) {
+			QVERIFY(dir.remove(name));
+		}
+	}
+
 private slots:
+	void cleanup() {
+		if (QStandardPaths::isTestModeEnabled()) {
+			removeMetadataCache();
+		}
+		NeovimConnector::setMetadataCacheEnabled(false);
+		QStandardPaths::setTestModeEnabled(false);
+	}
 
 	void reconnect() {
 		NeovimConnector c(new QBuffer());
@@ -38,6 +58,151 @@ private slots:
 		QVERIFY(c->isReady());
 	}
 
+	void apiLevels() {
+		NeovimConnector *c = NeovimConnector::spawn({"-u", "NONE"});
+		c->setParent(this);
+		QSignalSpy onReady(c, SIGNAL(ready()));
+		QVERIFY(onReady.isValid());
+		QVERIFY(SPYWAIT(onReady));
+
+		// All supported API levels share the same bindings
+		QVERIFY(c->api1());
+		QCOMPARE(c->api(c->apiLevel()), c->api1());
+		QCOMPARE(c->api(c->apiLevel() + 1), static_cast<NeovimApi*>(nullptr));
+
+		QCOMPARE(NeovimApi::functionApiLevel(NeovimApi::NEOVIM_FN_VIM_EVAL), quint64(0));
+		QCOMPARE(NeovimApi::functionApiLevel(NeovimApi::NEOVIM_FN_NVIM_EVAL), quint64(1));
+		QCOMPARE(NeovimApi::functionApiLevel(NeovimApi::NEOVIM_FN_NVIM_GET_MODE), quint64(2));
+		QVERIFY(c->api1()->hasFunction(NeovimApi::NEOVIM_FN_NVIM_EVAL));
+		QVERIFY(!c->api1()->hasFunction(NeovimApi::NEOVIM_FN_NULL));
+	}
+
+	void functionId() {
+		QCOMPARE(NeovimApi::functionId(QByteArray("nvim_eval")), NeovimApi::NEOVIM_FN_NVIM_EVAL);
+		QCOMPARE(NeovimApi::functionId(QByteArray("vim_eval")), NeovimApi::NEOVIM_FN_VIM_EVAL);
+		QCOMPARE(NeovimApi::functionId(QByteArray("nvim_no_such_function")), NeovimApi::NEOVIM_FN_NULL);
+		QCOMPARE(NeovimApi::functionId(QByteArray()), NeovimApi::NEOVIM_FN_NULL);
+
+		const Function getLines{ "ArrayOf(String)", "nvim_buf_get_lines",
+			QList<QString>{ "Buffer", "Integer", "Integer", "Boolean" }, false };
+		QCOMPARE(NeovimApi::functionId(getLines), NeovimApi::NEOVIM_FN_NVIM_BUF_GET_LINES);
+
+		// Same name, different signature
+		const Function wrongTypes{ "ArrayOf(String)", "nvim_buf_get_lines",
+			QList<QString>{ "Buffer", "Integer" }, false };
+		QCOMPARE(NeovimApi::functionId(wrongTypes), NeovimApi::NEOVIM_FN_NULL);
+
+		QVariantList ftable;
+		QVariantMap eval;
+		eval.insert("name", QByteArray("nvim_eval"));
+		eval.insert("return_type", QByteArray("Object"));
+		eval.insert("parameters", QVariantList{ QVariantList{ QByteArray("String"), QByteArray("expr") } });
+		ftable.append(eval);
+		// Level 0 requires the vim_* functions
+		QVERIFY(!NeovimApi::checkFunctions(ftable, 0));
+	}
+
+	void metadataCache() {
+		QStandardPaths::setTestModeEnabled(true);
+		removeMetadataCache();
+		NeovimConnector::setMetadataCacheEnabled(true);
+
+		// The first connection populates the cache
+		NeovimConnector *first = NeovimConnector::spawn({"-u", "NONE"});
+		first->setParent(this);
+		QSignalSpy onFirstReady(first, SIGNAL(ready()));
+		QVERIFY(onFirstReady.isValid());
+		QVERIFY(SPYWAIT(onFirstReady));
+		QVERIFY(first->channel() > 0);
+
+		// The second one is ready from the cache, and verified later
+		NeovimConnector *second = NeovimConnector::spawn({"-u", "NONE"});
+		second->setParent(this);
+		QSignalSpy onSecondReady(second, SIGNAL(ready()));
+		QVERIFY(onSecondReady.isValid());
+		QVERIFY(SPYWAIT(onSecondReady));
+		QCOMPARE(second->apiLevel(), first->apiLevel());
+		QCOMPARE(second->apiCompatibility(), first->apiCompatibility());
+		QCOMPARE(second->hasUIOption("ext_linegrid"), first->hasUIOption("ext_linegrid"));
+		QTRY_VERIFY(second->channel() > 0);
+		QCOMPARE(onSecondReady.count(), 1);
+		QVERIFY(second->isReady());
+	}
+
+	void batch() {
+		NeovimConnector *c = NeovimConnector::spawn({"-u", "NONE"});
+		c->setParent(this);
+		QSignalSpy onReady(c, SIGNAL(ready()));
+		QVERIFY(onReady.isValid());
+		QVERIFY(SPYWAIT(onReady));
+
+		NeovimBatch *b = c->startBatch();
+		QCOMPARE(b->call("vim_eval", { QByteArray("1+1") }), 0);
+		QCOMPARE(b->call("vim_set_var", { QByteArray("batch_test"), 42 }), 1);
+		QCOMPARE(b->call("vim_get_var", { QByteArray("batch_test") }), 2);
+		QCOMPARE(b->count(), 3);
+
+		QSignalSpy onFinished(b, SIGNAL(finished(QVariantList)));
+		QVERIFY(onFinished.isValid());
+		b->submit();
+		QVERIFY(SPYWAIT(onFinished));
+
+		const QVariantList results = onFinished.at(0).at(0).toList();
+		QCOMPARE(results.size(), 3);
+		QCOMPARE(results.at(0).toInt(), 2);
+		QCOMPARE(results.at(2).toInt(), 42);
+
+		// Calls after a failing call are not executed
+		NeovimBatch *failing = c->startBatch();
+		failing->call("vim_eval", { QByteArray("1") });
+		failing->call("vim_command", { QByteArray("NoSuchCommand") });
+		failing->call("vim_eval", { QByteArray("2") });
+
+		QSignalSpy onError(failing, SIGNAL(error(int, QVariant, QVariantList)));
+		QVERIFY(onError.isValid());
+		failing->submit();
+		QVERIFY(SPYWAIT(onError));
+		QCOMPARE(onError.at(0).at(0).toInt(), 1);
+		QCOMPARE(onError.at(0).at(2).toList(), QVariantList() << 1);
+	}
+
+	void typedCallback() {
+		NeovimConnector *c = NeovimConnector::spawn({"-u", "NONE"});
+		c->setParent(this);
+		QSignalSpy onReady(c, SIGNAL(ready()));
+		QVERIFY(onReady.isValid());
+		QVERIFY(SPYWAIT(onReady));
+		QVERIFY(c->api1());
+
+		const QList<QByteArray> lines{ "first", "second", "third" };
+		c->api1()->nvim_buf_set_lines(0, 0, -1, true, lines);
+
+		// The QVariant based signal is not emitted for typed callbacks
+		QSignalSpy onGetLines(c->api1(), SIGNAL(on_nvim_buf_get_lines(QList<QByteArray>)));
+		QVERIFY(onGetLines.isValid());
+
+		QList<QByteArray> result;
+		bool called{ false };
+		MsgpackRequest *r = c->api1()->nvim_buf_get_lines(0, 0, -1, true,
+			[&](QList<QByteArray> data) {
+				called = true;
+				result = data;
+			});
+		QSignalSpy onFinished(r, SIGNAL(finished(quint32, quint64, QVariant)));
+		QVERIFY(onFinished.isValid());
+		QVERIFY(SPYWAIT(onFinished));
+		QVERIFY(called);
+		QCOMPARE(result, lines);
+
+		int64_t buffer{ 0 };
+		MsgpackRequest *current = c->api1()->nvim_get_current_buf(
+			[&](int64_t data) { buffer = data; });
+		QSignalSpy onCurrent(current, SIGNAL(finished(quint32, quint64, QVariant)));
+		QVERIFY(SPYWAIT(onCurrent));
+		QVERIFY(buffer > 0);
+		QCOMPARE(onGetLines.count(), 0);
+	}
+
 	void encodeDecode() {
 		NeovimConnector *c = NeovimConnector::spawn({"-u", "NONE"});
 		c->setParent(this);
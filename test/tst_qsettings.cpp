@@ -18,6 +18,7 @@ private slots:
 	void cleanup() noexcept;
 
 	void OptionLineGrid() noexcept;
+	void OptionMultigrid() noexcept;
 	void OptionPopupMenu() noexcept;
 	void OptionTabline() noexcept;
 	void GuiFont() noexcept;
@@ -71,6 +72,20 @@ void TestQSettings::OptionLineGrid() noexcept
 	QCOMPARE(shellOptionsLegacy.IsLineGridEnabled(), false);
 }
 
+void TestQSettings::OptionMultigrid() noexcept
+{
+	QSettings settings;
+
+	auto sDefault = CreateShellWidget();
+	QCOMPARE(sDefault->GetShellOptions().IsMultigridEnabled(), false);
+
+	settings.setValue("ext_multigrid", true);
+	auto sWithMultigrid = CreateShellWidget();
+	ShellOptions shellOptionsWithMultigrid{ sWithMultigrid->GetShellOptions() };
+
+	QCOMPARE(shellOptionsWithMultigrid.IsMultigridEnabled(), true);
+}
+
 void TestQSettings::OptionPopupMenu() noexcept
 {
 	auto w = CreateMainWindowWithRuntime();